@@ -0,0 +1,79 @@
+/**
+ * @file BootProfile.h
+ * @brief Boot-phase timestamps and the power-on-to-interactive metric.
+ *
+ * Each boot step marks its phase once when it completes. Phases run in
+ * several tasks (the TFT comes up in TaskRender while setup() carries on),
+ * so the phases are also bits of an event group that can be waited on.
+ *
+ * The device is interactive once setup() has returned, the boot logo is
+ * lit and the stored settings are in the UI model. That time is kept
+ * across deep sleep together with the best and worst seen since power-up,
+ * and logged with the phase table by BootProfile_report().
+ *
+ * Times come from `esp_timer_get_time()` and so start when the app starts;
+ * the ROM and second-stage bootloader (~tens of ms) come before zero.
+ */
+#ifndef BOOTPROFILE_H
+#define BOOTPROFILE_H
+
+#include <freertos/FreeRTOS.h>
+#include <stdint.h>
+
+/** @brief Boot steps, each marked when it completes. */
+typedef enum : uint8_t
+{
+    BOOT_PHASE_CONFIG,     /**< Queues and input ring created */
+    BOOT_PHASE_UI,         /**< UI model and TaskUI ready */
+    BOOT_PHASE_POWER,      /**< TaskPower started */
+    BOOT_PHASE_SAVE_DATA,  /**< TaskSaveData started */
+    BOOT_PHASE_ENCODER,    /**< Encoder decoding */
+    BOOT_PHASE_MOTOR,      /**< Motor channels and counters ready */
+    BOOT_PHASE_BUZZER,     /**< Buzzer ready */
+    BOOT_PHASE_TELEMETRY,  /**< USB-CDC started */
+    BOOT_PHASE_SETUP_DONE, /**< setup() returned */
+    BOOT_PHASE_TFT_READY,  /**< TFT, renderer and backlight PWM initialised (TaskRender) */
+    BOOT_PHASE_LOGO,       /**< Boot logo drawn and lit */
+    BOOT_PHASE_SETTINGS,   /**< Stored settings applied to the UI */
+    BOOT_PHASE_COUNT
+}BootPhase;
+
+/**
+ * @brief Starts the clock of the phase table.
+ *
+ * Must be called first thing in setup().
+ */
+void BootProfile_init();
+
+/**
+ * @brief Records that `phase` completed. Only the first call per boot counts.
+ *
+ * Safe from any task.
+ */
+void BootProfile_mark(BootPhase phase);
+
+/**
+ * @brief Returns the time `phase` completed in microseconds since app start; 0 if not yet.
+ */
+uint32_t BootProfile_phaseUs(BootPhase phase);
+
+/**
+ * @brief Blocks until the device is interactive.
+ *
+ * @return true if it became interactive within `timeout`.
+ */
+bool BootProfile_waitInteractive(TickType_t timeout);
+
+/**
+ * @brief Returns the power-on-to-interactive time of this boot in microseconds; 0 if not yet.
+ */
+uint32_t BootProfile_interactiveUs();
+
+/**
+ * @brief Logs the phase table and the interactive time with its best and worst.
+ *
+ * Call once after BootProfile_waitInteractive() returned true.
+ */
+void BootProfile_report();
+
+#endif // BOOTPROFILE_H
@@ -16,11 +16,7 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/queue.h>
 #include <stdint.h>
-
-/**
- * @brief UI input event queue (encoder + buttons).
- */
-extern QueueHandle_t xUIQueue;
+#include "Input/InputEvent.h"
 
 /**
  * @brief Motor control command queue.
@@ -46,19 +42,7 @@ extern QueueHandle_t xBuzzerQueue;
    UI EVENTS
    ========================= */
 
-/**
- * @brief Rotary encoder and button event types.
- *
- * Used by TaskEncoder to communicate UI interactions
- * to the UI task and state machine.
- */
-typedef enum
-{
-    ENC_LEFT   = 0, /**< Encoder rotated counter-clockwise */
-    ENC_RIGHT  = 1, /**< Encoder rotated clockwise */
-    BTN_SHORT  = 2, /**< Short button press */
-    BTN_LONG   = 3  /**< Long button press */
-}EncoderEvent;
+/* InputEventType and InputEvent live in Input/InputEvent.h. */
 
 /* =========================
    BUZZER COMMANDS
@@ -102,8 +86,18 @@ typedef enum
     MOTOR_CMD_CLEAN_SLOW,    /**< Execute slow cleaning routine */
     MOTOR_CMD_CLEAN_MANUAL,  /**< Execute manual cleaning routine */
     MOTOR_CMD_CLEAN_PURGE,   /**< Execute purge cleaning routine */
+    MOTOR_CMD_SHUTDOWN,      /**< Stop every channel, then write pending usage counters to flash */
+    MOTOR_CMD_PAUSE,         /**< Freeze the running operation, keeping its progress */
+    MOTOR_CMD_RESUME,        /**< Continue a paused operation where it stopped */
+    MOTOR_CMD_CHARACTERISE,  /**< Sweep duty and store the pump's own speed curve */
 }MotorCmdType;
 
+/** @brief MotorCommand flag: end a purge as soon as the line is detected full. */
+static constexpr uint8_t MOTOR_FLAG_STOP_WHEN_PRIMED = 0x01;
+
+/** @brief MotorCommand channel value addressing every pump channel at once. */
+static constexpr uint8_t MOTOR_CHANNEL_ALL = 0xFF;
+
 /**
  * @brief Motor command message payload.
  *
@@ -114,6 +108,9 @@ typedef struct
     MotorCmdType type; /**< Command type */
     uint8_t speed;     /**< Speed percentage (0–100) */
     uint32_t duration;/**< Run duration in ms */
+    uint16_t rampMs;   /**< Purge ramp-up time in ms; 0 selects the default */
+    uint8_t flags;     /**< MOTOR_FLAG_* options */
+    uint8_t channel;   /**< Pump channel (0 … MOTOR_CHANNEL_COUNT-1) or MOTOR_CHANNEL_ALL */
 }MotorCommand;
 
 /* =========================
@@ -174,7 +171,7 @@ typedef struct
    ========================= */
 
 /**
- * @brief Initializes all system queues.
+ * @brief Initializes all system queues and the input ring.
  *
  * Must be called once during system startup
  * before any task attempts queue communication.
@@ -188,8 +185,34 @@ void Config_init();
  * @param speed    Speed percentage (0–100); used by MOTOR_CMD_SET_SPEED and
  *                 MOTOR_CMD_START_TIMED; ignored for all other command types.
  * @param duration Run duration in ms; 0 means no timeout.
+ * @param channel  Target pump channel, or MOTOR_CHANNEL_ALL.
  */
-void sendMotorRequest(MotorCmdType type, int speed, uint32_t duration);
+void sendMotorRequest(MotorCmdType type, int speed, uint32_t duration, uint8_t channel = 0);
+
+/**
+ * @brief Posts a MOTOR_CMD_CLEAN_PURGE command to `xMotorQueue`.
+ *
+ * @param speed          Purge speed percentage (0–100); 0 selects the default.
+ * @param duration       Maximum purge duration in ms; 0 selects the default.
+ * @param rampMs         Ramp-up time from rest to `speed` in ms; 0 selects the default.
+ * @param stopWhenPrimed End early once the line is detected full. Ignored
+ *                       when no line sensor or current sensing is fitted.
+ * @param channel        Target pump channel, or MOTOR_CHANNEL_ALL.
+ */
+void sendPurgeRequest(int speed, uint32_t duration, uint16_t rampMs, bool stopWhenPrimed,
+                      uint8_t channel = 0);
+
+/**
+ * @brief Puts MOTOR_CMD_SHUTDOWN at the front of `xMotorQueue`.
+ *
+ * Unlike the other senders this waits up to `waitMs` for a free slot and
+ * never asserts: powering off must not reboot the device, whatever the
+ * UI has queued.
+ *
+ * @param waitMs Longest wait for a free slot.
+ * @return false if the queue stayed full and the command was not posted.
+ */
+bool sendMotorShutdown(uint32_t waitMs);
 
 /**
  * @brief Posts a power command to `xPowerQueue`.
@@ -212,10 +235,20 @@ void sendPowerRequest(PowerCmdType type);
 void sendSettingsSave(SettingsCmdType type, int motorSpeed, uint8_t timeIndex);
 
 /**
- * @brief Posts a buzzer command to `xBuzzerQueue`.
+ * @brief Posts a buzzer command to `xBuzzerQueue`. Never blocks.
+ *
+ * TaskBuzzer plays each melody to the end before taking the next, so a
+ * burst of feedback can fill the queue. The command is then dropped and
+ * counted rather than treated as a fault; a missing beep is harmless.
  *
  * @param type Command type.
+ * @return false if the queue was full and the command was dropped.
+ */
+bool sendBuzzerCommand(BuzzerCmdType type);
+
+/**
+ * @brief Returns the number of buzzer commands dropped since boot.
  */
-void sendBuzzerCommand(BuzzerCmdType type);
+uint32_t buzzerCommandsDropped();
 
 #endif
@@ -17,8 +17,16 @@ static constexpr int PIN_DT      = 10;
 /** @brief Encoder push-button, active-low (EXT0 deep-sleep wake source). */
 static constexpr int PIN_SW      = 12;
 
-/** @brief Motor PWM output. */
-static constexpr int PIN_MOTOR   = 21;
+/**
+ * @brief Number of independently driven pump channels.
+ *
+ * Each channel gets its own PWM output, LEDC channel, drip generator,
+ * cleaning program and status. The 4-pump board revision uses 4.
+ */
+static constexpr int MOTOR_CHANNEL_COUNT = 1;
+
+/** @brief Motor PWM output per pump channel. */
+static constexpr int PIN_MOTOR[MOTOR_CHANNEL_COUNT] = { 21 };
 
 /** @brief Passive buzzer PWM output. */
 static constexpr int PIN_BUZZER  = 47;
@@ -26,4 +34,28 @@ static constexpr int PIN_BUZZER  = 47;
 /** @brief TFT backlight LED enable. */
 static constexpr int PIN_TFT_LED = 15;
 
+/**
+ * @brief Line-full sensor input per pump channel, active-low (liquid
+ *        detected at the outlet).
+ *
+ * -1 when the sensor is not fitted.
+ */
+static constexpr int PIN_LINE_SENSOR[MOTOR_CHANNEL_COUNT]   = { -1 };
+
+/**
+ * @brief Motor current-sense ADC input per pump channel (shunt amplifier
+ *        output).
+ *
+ * -1 when current sensing is not fitted.
+ */
+static constexpr int PIN_MOTOR_CURRENT[MOTOR_CHANNEL_COUNT] = { -1 };
+
+/**
+ * @brief Drop-counter input per pump channel, one falling edge per drop
+ *        (optical drip-chamber sensor).
+ *
+ * -1 when the sensor is not fitted.
+ */
+static constexpr int PIN_DROP_SENSOR[MOTOR_CHANNEL_COUNT]   = { -1 };
+
 #endif // PINS_H
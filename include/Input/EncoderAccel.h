@@ -0,0 +1,88 @@
+/**
+ * @file EncoderAccel.h
+ * @brief Velocity-based encoder acceleration for numeric fields.
+ *
+ * The knob velocity is measured over a short window of detent timestamps
+ * (ACCEL_HISTORY events no older than `windowMs`) and mapped through a
+ * smooth curve to a step size:
+ * - at or below `slowDps` every detent moves the value by exactly one;
+ * - between `slowDps` and `fastDps` the step rises quadratically;
+ * - at or above `fastDps` the step is `maxStepPct` percent of the range.
+ *
+ * Near the end of the range the step is capped to a fraction of the
+ * remaining distance (`edgeDivisor`), so a flick slows down as it
+ * approaches the limit instead of slamming into it. Reversing direction
+ * restarts the measurement, so the first detent back is always a single
+ * step.
+ *
+ * The same curve serves every numeric field: the step is scaled to each
+ * field's range, so narrow ranges stay unaccelerated. Pure C++ with no
+ * Arduino dependency.
+ */
+#ifndef ENCODERACCEL_H
+#define ENCODERACCEL_H
+
+#include <stdint.h>
+
+/** @brief Number of past rotation events kept for the velocity estimate. */
+static constexpr uint8_t ACCEL_HISTORY = 8;
+
+/** @brief Acceleration curve parameters. */
+struct EncoderAccelCurve
+{
+    uint16_t windowMs;    ///< Events older than this do not count towards velocity.
+    uint16_t slowDps;     ///< Velocity (detents/s) up to which steps are single.
+    uint16_t fastDps;     ///< Velocity (detents/s) at which the full step is reached.
+    uint8_t  maxStepPct;  ///< Full step as a percentage of the field's range.
+    uint8_t  edgeDivisor; ///< The step never exceeds 1 + distance-to-limit / edgeDivisor.
+};
+
+/**
+ * @brief Curve used by every numeric field.
+ *
+ * For the 0–100 % speed field a fast flick moves 10 per detent, so the whole
+ * range is covered in well under a turn, while deliberate turning stays at 1.
+ */
+static constexpr EncoderAccelCurve ACCEL_CURVE_DEFAULT = {
+    .windowMs    = 200,
+    .slowDps     = 8,
+    .fastDps     = 40,
+    .maxStepPct  = 10,
+    .edgeDivisor = 3
+};
+
+/** @brief Per-field acceleration state. */
+struct EncoderAccel
+{
+    uint32_t stampMs[ACCEL_HISTORY]; ///< Timestamps of recent rotation events.
+    uint16_t detents[ACCEL_HISTORY]; ///< Detent count of each recent event.
+    uint8_t  first;                  ///< Index of the oldest event.
+    uint8_t  count;                  ///< Number of events held.
+    int8_t   dir;                    ///< Direction of the held events (+1/−1, 0 when empty).
+    uint8_t  residualQ8;             ///< Fractional step carried to the next event (1/256).
+};
+
+/**
+ * @brief Clears the history; the next detent is a single step.
+ */
+void EncoderAccel_reset(EncoderAccel* accel);
+
+/**
+ * @brief Applies a rotation to a bounded value.
+ *
+ * @param accel       Field state.
+ * @param curve       Acceleration curve.
+ * @param delta       Detents turned, positive clockwise.
+ * @param timestampMs Time of the last of those detents.
+ * @param value       Current value.
+ * @param minValue    Lower bound.
+ * @param maxValue    Upper bound.
+ * @param saturated   Optional; set to true when the rotation pushed past a bound.
+ * @return New value, clamped to `minValue`…`maxValue`.
+ */
+int32_t EncoderAccel_apply(EncoderAccel* accel, const EncoderAccelCurve& curve,
+                           int16_t delta, uint32_t timestampMs,
+                           int32_t value, int32_t minValue, int32_t maxValue,
+                           bool* saturated);
+
+#endif // ENCODERACCEL_H
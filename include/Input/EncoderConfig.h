@@ -0,0 +1,32 @@
+/**
+ * @file EncoderConfig.h
+ * @brief Detent geometry of the fitted rotary encoder.
+ *
+ * Kept apart from TaskEncoder.h and free of Arduino/FreeRTOS dependencies
+ * so the host tests decode with the configuration the firmware ships.
+ */
+#ifndef ENCODERCONFIG_H
+#define ENCODERCONFIG_H
+
+#include "Input/QuadratureDecoder.h"
+#include <stdint.h>
+
+/**
+ * @brief Quadrature steps between two encoder detents.
+ *
+ * The EC11 rests alternately in 0b01 and 0b10, so one detent spans two
+ * edges of the 4× decoded signal.
+ */
+static constexpr QuadStepMode ENCODER_STEP_MODE = QUAD_HALF_STEP;
+
+/**
+ * @brief Detent rest states of the encoder (`(CLK << 1) | DT`).
+ *
+ * Only used by the table decoder; PCNT counts relative to power-up.
+ */
+static constexpr uint8_t ENCODER_REST_STATES = QUAD_STATE_BIT(0b01) | QUAD_STATE_BIT(0b10);
+
+/** @brief Quadrature counts between two encoder detents. */
+static constexpr int16_t ENCODER_COUNTS_PER_DETENT = ENCODER_STEP_MODE;
+
+#endif // ENCODERCONFIG_H
@@ -0,0 +1,117 @@
+/**
+ * @file Gesture.h
+ * @brief Timestamp-driven push-button and press-and-rotate gesture recogniser.
+ *
+ * TaskEncoder feeds debounced button edges, detents and periodic ticks, all
+ * carrying their capture time, and gets InputEvents back:
+ *
+ * | Gesture                               | Event            |
+ * |---------------------------------------|------------------|
+ * | Click, no second press within window  | BTN_SHORT        |
+ * | Two clicks within `doubleClickMs`     | BTN_DOUBLE       |
+ * | Hold for `longPressMs`                | BTN_LONG         |
+ * | Keep holding after BTN_LONG           | BTN_REPEAT, every `repeatPeriodMs` after `repeatDelayMs` |
+ * | Rotate while held                     | ENC_PRESS_ROTATE (no click or long press follows) |
+ * | Rotate while released                 | ENC_ROTATE       |
+ *
+ * A single click is only reported once the double-click window has passed;
+ * setting `doubleClickMs` to 0 disables double-click and reports clicks on
+ * release. A pending click is flushed before a rotation so the order of
+ * input is preserved.
+ *
+ * The recogniser never reads a clock: time only comes from its arguments,
+ * so it runs unchanged on a host (`test/test_gesture`, `pio test -e native`).
+ */
+#ifndef GESTURE_H
+#define GESTURE_H
+
+#include "Input/InputEvent.h"
+#include <stdint.h>
+
+/** @brief Maximum number of events a single Gesture_* call may produce. */
+static constexpr uint8_t GESTURE_MAX_EVENTS = 2;
+
+/** @brief Gesture timing. */
+struct GestureConfig
+{
+    uint16_t longPressMs;    ///< Hold time that makes a press a long press.
+    uint16_t doubleClickMs;  ///< Maximum release-to-press gap of a double click; 0 disables it.
+    uint16_t repeatDelayMs;  ///< Hold time after BTN_LONG before the first BTN_REPEAT.
+    uint16_t repeatPeriodMs; ///< Interval between BTN_REPEAT events; 0 disables repeat.
+};
+
+/** @brief Timing used by TaskEncoder. */
+static constexpr GestureConfig GESTURE_CONFIG_DEFAULT = {
+    .longPressMs    = 600,
+    .doubleClickMs  = 250,
+    .repeatDelayMs  = 400,
+    .repeatPeriodMs = 400
+};
+
+/** @brief Recogniser states. */
+typedef enum : uint8_t
+{
+    GESTURE_IDLE,           /**< Released, nothing pending */
+    GESTURE_PRESSED,        /**< First press, below the long-press threshold */
+    GESTURE_CLICK_PENDING,  /**< Released after a click, waiting for a second press */
+    GESTURE_SECOND_PRESSED, /**< Second press of a possible double click */
+    GESTURE_HELD,           /**< Long press reported; repeating while held */
+    GESTURE_ROTATED         /**< Rotated while held; release reports nothing */
+}GestureState;
+
+/** @brief Recogniser state. */
+struct Gesture
+{
+    GestureConfig config;        ///< Timing.
+    GestureState  state;         ///< Current state.
+    uint32_t      pressMs;       ///< Time of the current press, or of the pending click's press.
+    uint32_t      releaseMs;     ///< Time the pending click was released.
+    uint32_t      secondPressMs; ///< Time of the second press of a possible double click.
+    uint32_t      nextRepeatMs;  ///< Time of the next BTN_REPEAT while held.
+};
+
+/**
+ * @brief Initialises a recogniser in the released state.
+ */
+void Gesture_init(Gesture* g, const GestureConfig& config);
+
+/**
+ * @brief Feeds a debounced button edge.
+ *
+ * @param g       Recogniser.
+ * @param pressed New button level.
+ * @param nowMs   Time of the edge.
+ * @param out     Receives up to GESTURE_MAX_EVENTS events.
+ * @return Number of events written to `out`.
+ */
+uint8_t Gesture_button(Gesture* g, bool pressed, uint32_t nowMs, InputEvent* out);
+
+/**
+ * @brief Feeds detents.
+ *
+ * @param g     Recogniser.
+ * @param delta Net detents, positive clockwise.
+ * @param nowMs Time of the last detent.
+ * @param out   Receives up to GESTURE_MAX_EVENTS events.
+ * @return Number of events written to `out`.
+ */
+uint8_t Gesture_rotate(Gesture* g, int16_t delta, uint32_t nowMs, InputEvent* out);
+
+/**
+ * @brief Reports time-based gestures (long press, repeat, single click) that are due.
+ *
+ * @param g     Recogniser.
+ * @param nowMs Current time.
+ * @param out   Receives up to GESTURE_MAX_EVENTS events.
+ * @return Number of events written to `out`.
+ */
+uint8_t Gesture_tick(Gesture* g, uint32_t nowMs, InputEvent* out);
+
+/**
+ * @brief Returns how long until Gesture_tick() has something to report.
+ *
+ * @return Milliseconds from `nowMs`, or UINT32_MAX when nothing is pending.
+ */
+uint32_t Gesture_msUntilDeadline(const Gesture* g, uint32_t nowMs);
+
+#endif // GESTURE_H
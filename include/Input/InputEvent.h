@@ -0,0 +1,42 @@
+/**
+ * @file InputEvent.h
+ * @brief Rotary encoder and button events passed from TaskEncoder to the UI.
+ *
+ * Kept free of Arduino/FreeRTOS dependencies so the input modules that
+ * produce these events build on a host.
+ */
+#ifndef INPUTEVENT_H
+#define INPUTEVENT_H
+
+#include <stdint.h>
+
+/**
+ * @brief Rotary encoder and button event types.
+ */
+typedef enum
+{
+    ENC_ROTATE       = 0, /**< Encoder rotated by `delta` detents */
+    BTN_SHORT        = 1, /**< Short button press */
+    BTN_LONG         = 2, /**< Long button press */
+    ENC_PRESS_ROTATE = 3, /**< Encoder rotated by `delta` detents while the button is held */
+    BTN_DOUBLE       = 4, /**< Two short presses in quick succession */
+    BTN_REPEAT       = 5  /**< Button still held after BTN_LONG; sent periodically */
+}InputEventType;
+
+/**
+ * @brief UI input event payload.
+ *
+ * Used by TaskEncoder to communicate UI interactions to the UI task and
+ * state machine through InputRing (Input/InputRing.h). One ENC_ROTATE event
+ * carries every detent captured since the previous one, and unread
+ * rotations are merged in the ring, so a fast spin costs a single slot.
+ */
+typedef struct
+{
+    InputEventType type;        /**< Event type */
+    int16_t        delta;       /**< Net detents, positive clockwise (ENC_* only) */
+    uint32_t       timestampMs; /**< `millis()` at which the last detent or button edge was captured */
+    uint32_t       pressMs;     /**< How long the button was held (BTN_* only) */
+}InputEvent;
+
+#endif // INPUTEVENT_H
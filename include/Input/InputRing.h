@@ -0,0 +1,78 @@
+/**
+ * @file InputRing.h
+ * @brief Lock-free input event buffer between TaskEncoder and TaskUI.
+ *
+ * A single producer (TaskEncoder) pushes InputEvents and a single consumer
+ * (TaskUI) pops them; neither side ever blocks. Three rules keep input
+ * from being lost or from taking the system down while the UI is busy:
+ * - A rotation pushed while the newest pending event is still an unread
+ *   rotation of the same type (ENC_ROTATE or ENC_PRESS_ROTATE) is merged
+ *   into it, so a fast spin occupies one slot however long the UI takes
+ *   to catch up.
+ * - Rotations may only use INPUT_RING_CAPACITY − INPUT_RING_BUTTON_RESERVE
+ *   slots; the rest are kept free for button events.
+ * - When an event still does not fit it is dropped and counted, never
+ *   asserted.
+ *
+ * The consumer task is woken through its task notification.
+ */
+#ifndef INPUTRING_H
+#define INPUTRING_H
+
+#include "Config/config.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <stdint.h>
+
+/** @brief Buffer capacity in events. Must be a power of two. */
+static constexpr uint32_t INPUT_RING_CAPACITY       = 16;
+
+/** @brief Slots that only button events may use. */
+static constexpr uint32_t INPUT_RING_BUTTON_RESERVE = 4;
+
+static_assert((INPUT_RING_CAPACITY & (INPUT_RING_CAPACITY - 1)) == 0,
+              "INPUT_RING_CAPACITY must be a power of two");
+
+static_assert(INPUT_RING_BUTTON_RESERVE < INPUT_RING_CAPACITY,
+              "rotations need at least one slot");
+
+/**
+ * @brief Marks every slot empty.
+ *
+ * Must be called once from `Config_init()` before TaskEncoder starts.
+ */
+void InputRing_init();
+
+/**
+ * @brief Sets the task notified after every successful push.
+ *
+ * Events pushed before a consumer is set stay buffered; the consumer
+ * should drain once before its first wait.
+ */
+void InputRing_setConsumer(TaskHandle_t task);
+
+/**
+ * @brief Appends an event. Never blocks.
+ *
+ * Must only be called from the producer task.
+ *
+ * @return false if the event was dropped because the buffer was full.
+ */
+bool InputRing_push(const InputEvent& evt);
+
+/**
+ * @brief Takes the oldest event.
+ *
+ * Must only be called from the consumer task.
+ *
+ * @param out Receives the event.
+ * @return false if the buffer is empty.
+ */
+bool InputRing_pop(InputEvent* out);
+
+/**
+ * @brief Returns the number of events dropped because the buffer was full.
+ */
+uint32_t InputRing_dropped();
+
+#endif // INPUTRING_H
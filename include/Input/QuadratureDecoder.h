@@ -0,0 +1,116 @@
+/**
+ * @file QuadratureDecoder.h
+ * @brief Table-driven quadrature decoder for full-, half- and quarter-step encoders.
+ *
+ * Each sample is the 2-bit pin state `(A << 1) | B`. A 16-entry table
+ * indexed by `(previous << 2) | current` yields the quarter-step movement
+ * (+1 clockwise, −1 counter-clockwise, 0 for no change or an illegal jump
+ * where both pins changed at once). Movement is accumulated and turned into
+ * a detent only when the encoder arrives in one of its rest states, after
+ * which the accumulator is cleared:
+ * - contact bounce (A→B→A) cancels out in the accumulator and never
+ *   produces a detent;
+ * - an illegal jump contributes nothing, and the next rest state
+ *   resynchronises the decoder instead of leaving it one count off.
+ *
+ * A detent is reported once at least half of the steps between two rest
+ * states have been seen in one direction, so one missed intermediate state
+ * does not lose the detent.
+ *
+ * Header-only and free of Arduino/FreeRTOS dependencies so it can be built
+ * and exercised on a host (`test/test_quadrature`, `pio test -e native`);
+ * `QuadDecoder_update()` is safe to call from an ISR.
+ */
+#ifndef QUADRATUREDECODER_H
+#define QUADRATUREDECODER_H
+
+#include <stdint.h>
+
+/** @brief Quadrature steps between two detents. */
+typedef enum : uint8_t
+{
+    QUAD_FULL_STEP    = 4, /**< One detent per full quadrature cycle */
+    QUAD_HALF_STEP    = 2, /**< Two detents per cycle (e.g. EC11) */
+    QUAD_QUARTER_STEP = 1  /**< A detent on every state */
+}QuadStepMode;
+
+/** @brief Rest-state mask bit for the 2-bit state `s`. */
+#define QUAD_STATE_BIT(s) ((uint8_t)(1u << (s)))
+
+/** @brief Rest states of a typical full-step encoder: both contacts open. */
+static constexpr uint8_t QUAD_REST_FULL    = QUAD_STATE_BIT(0b11);
+
+/** @brief Rest states of a typical half-step encoder: both contacts equal. */
+static constexpr uint8_t QUAD_REST_HALF    = QUAD_STATE_BIT(0b00) | QUAD_STATE_BIT(0b11);
+
+/** @brief Rest states of a quarter-step encoder: every state. */
+static constexpr uint8_t QUAD_REST_QUARTER = 0x0F;
+
+/**
+ * @brief Quarter-step movement per `(previous << 2) | current` transition.
+ *
+ * Clockwise order is 00 → 10 → 11 → 01 → 00.
+ */
+static constexpr int8_t QUAD_TRANSITION_TABLE[16] = {
+    /* 00→00 */  0, /* 00→01 */ -1, /* 00→10 */ +1, /* 00→11 */  0,
+    /* 01→00 */ +1, /* 01→01 */  0, /* 01→10 */  0, /* 01→11 */ -1,
+    /* 10→00 */ -1, /* 10→01 */  0, /* 10→10 */  0, /* 10→11 */ +1,
+    /* 11→00 */  0, /* 11→01 */ +1, /* 11→10 */ -1, /* 11→11 */  0,
+};
+
+/** @brief Decoder state. */
+struct QuadDecoder
+{
+    uint8_t state;     ///< Last 2-bit pin state.
+    int8_t  acc;       ///< Quarter steps since the last rest state.
+    uint8_t restMask;  ///< QUAD_STATE_BIT() mask of the detent rest states.
+    int8_t  threshold; ///< Quarter steps needed to report a detent.
+};
+
+/**
+ * @brief Initialises a decoder.
+ *
+ * @param d            Decoder.
+ * @param mode         Steps between two detents.
+ * @param restMask     Rest states of the encoder (QUAD_REST_* or a custom mask).
+ * @param initialState Current 2-bit pin state.
+ */
+static inline void QuadDecoder_init(QuadDecoder* d, QuadStepMode mode, uint8_t restMask, uint8_t initialState)
+{
+    d->state     = initialState & 0x03;
+    d->acc       = 0;
+    d->restMask  = restMask;
+    d->threshold = (int8_t)((mode + 1) / 2);
+}
+
+/**
+ * @brief Feeds one pin sample.
+ *
+ * @param d     Decoder.
+ * @param state 2-bit pin state `(A << 1) | B`.
+ * @return +1 for a clockwise detent, −1 for a counter-clockwise detent, 0 otherwise.
+ */
+static inline int8_t QuadDecoder_update(QuadDecoder* d, uint8_t state)
+{
+    state &= 0x03;
+
+    if (state == d->state)
+        return 0;
+
+    int8_t acc = (int8_t)(d->acc + QUAD_TRANSITION_TABLE[(d->state << 2) | state]);
+    d->state   = state;
+
+    if ((d->restMask & QUAD_STATE_BIT(state)) == 0)
+    {
+        d->acc = acc;
+        return 0;
+    }
+
+    d->acc = 0;
+
+    if (acc >= d->threshold)  return +1;
+    if (acc <= -d->threshold) return -1;
+    return 0;
+}
+
+#endif // QUADRATUREDECODER_H
@@ -0,0 +1,166 @@
+/**
+ * @file MotorCalibration.h
+ * @brief Per-pump speed curve and the on-device characterisation sweep.
+ *
+ * Out of the box every pump uses the reference curve: a 20 % minimum duty
+ * with a quadratic rise, and a drip range of 45. MOTOR_CMD_CHARACTERISE
+ * replaces these with measured values:
+ * - The duty is swept from 0 to MAX_DUTY in CAL_SWEEP_STEPS steps while the
+ *   feedback is averaged per step. Feedback is the motor current
+ *   (`PIN_MOTOR_CURRENT`) or, failing that, the drop rate
+ *   (`PIN_DROP_SENSOR`).
+ * - The **start threshold** is the first step whose feedback rises clearly
+ *   above the idle baseline. The **full duty** is the first step reaching
+ *   CAL_FULL_PCT of the final feedback; duty beyond it adds nothing.
+ * - The speed curve maps 1–100 % onto start…full so that equal dial steps
+ *   give equal feedback steps.
+ * - With a drop sensor, drip bursts are then run at CAL_DRIP_STEPS rising
+ *   rates. The **drip range** is the fastest rate at which every burst
+ *   still gives one separate drop. Without a drop sensor, or when the
+ *   slowest rate already fails, the drip range stays at
+ *   CAL_DRIP_RANGE_DEFAULT.
+ *
+ * Curves are stored per channel in NVS (namespace `motorcal`). Only
+ * TaskMotor may use this module.
+ */
+#ifndef MOTORCALIBRATION_H
+#define MOTORCALIBRATION_H
+
+#include <stdint.h>
+
+/** @brief Number of points in a speed curve (0, 10, …, 100 %). */
+static constexpr uint8_t  CAL_CURVE_POINTS       = 11;
+
+/** @brief Number of duty steps in the characterisation sweep. */
+static constexpr uint8_t  CAL_SWEEP_STEPS        = 50;
+
+/** @brief Period at which TaskMotor must call MotorCal_update(). */
+static constexpr uint32_t CAL_TICK_MS            = 20;
+
+/** @brief Motor-off window used to learn the idle feedback baseline. */
+static constexpr uint32_t CAL_BASELINE_MS        = 500;
+
+/** @brief Time allowed for the pump to settle after each duty step. */
+static constexpr uint32_t CAL_SETTLE_MS          = 300;
+
+/** @brief Current averaging window per step. */
+static constexpr uint32_t CAL_CURRENT_WINDOW_MS  = 200;
+
+/** @brief Drop counting window per step; drops are far sparser than ADC samples. */
+static constexpr uint32_t CAL_DROP_WINDOW_MS     = 2000;
+
+/** @brief Current rise over the baseline, in percent, that marks the pump as turning. */
+static constexpr uint32_t CAL_START_DELTA_PCT    = 10;
+
+/** @brief Minimum absolute current rise (mV) that marks the pump as turning. */
+static constexpr uint32_t CAL_START_DELTA_MIN_MV = 20;
+
+/** @brief Fraction of the final feedback, in percent, at which the range is considered full. */
+static constexpr uint32_t CAL_FULL_PCT           = 95;
+
+/** @brief Drip range used until a pump has been characterised, or when it could not be measured. */
+static constexpr uint8_t  CAL_DRIP_RANGE_DEFAULT = 45;
+
+/** @brief Burst period of drip speed 1; speed `m` of the drip range bursts every `CAL_DRIP_PERIOD_MS / m`. */
+static constexpr uint32_t CAL_DRIP_PERIOD_MS     = 10000;
+
+/** @brief Burst rates tried by the drip sweep: drip speeds 10, 20, …, 100. */
+static constexpr uint8_t  CAL_DRIP_STEPS         = 10;
+
+/** @brief Time allowed for the drip pattern to settle at each burst rate. */
+static constexpr uint32_t CAL_DRIP_SETTLE_MS     = 1000;
+
+/** @brief Drop counting window per burst rate. */
+static constexpr uint32_t CAL_DRIP_WINDOW_MS     = 5000;
+
+/** @brief Largest deviation of drops from bursts, in percent, at which drops still count as separate. */
+static constexpr uint32_t CAL_DRIP_TOLERANCE_PCT = 10;
+
+/** @brief Stored speed curve of one pump. */
+struct MotorCurve
+{
+    uint8_t  version;                  ///< Layout version; mismatching records are ignored.
+    uint8_t  dripRange;                ///< Upper bound of the drip speed mapping; measured or CAL_DRIP_RANGE_DEFAULT.
+    uint16_t startDuty;                ///< Lowest duty that starts the pump from rest.
+    uint16_t fullDuty;                 ///< Duty beyond which output no longer increases.
+    uint16_t points[CAL_CURVE_POINTS]; ///< Duty at 0, 10, …, 100 % speed.
+};
+
+/** @brief Outcome of one MotorCal_update() call. */
+typedef enum
+{
+    CAL_RUNNING, /**< Sweep in progress; apply the returned duty */
+    CAL_DONE,    /**< Curve generated and stored */
+    CAL_FAILED   /**< No usable start threshold or range found; curve unchanged */
+}MotorCalResult;
+
+/**
+ * @brief Loads stored curves and configures the drop sensor inputs.
+ *
+ * Must be called once from `TaskMotor_init()`.
+ */
+void MotorCal_init();
+
+/**
+ * @brief Returns true when `channel` has current sensing or a drop sensor.
+ */
+bool MotorCal_available(uint8_t channel);
+
+/**
+ * @brief Returns true when `channel` uses a measured curve.
+ */
+bool MotorCal_isCalibrated(uint8_t channel);
+
+/**
+ * @brief Maps a speed percentage to an LEDC duty with the channel's curve.
+ *
+ * @param channel Pump channel.
+ * @param percent Speed in the range 0–100 %.
+ * @return LEDC duty value in the range 0–MAX_DUTY.
+ */
+uint32_t MotorCal_speedToDuty(uint8_t channel, uint8_t percent);
+
+/**
+ * @brief Returns the upper bound of the drip speed mapping for `channel`.
+ */
+uint8_t MotorCal_dripRange(uint8_t channel);
+
+/**
+ * @brief Copies the active curve of `channel` (measured or reference).
+ */
+void MotorCal_getCurve(uint8_t channel, MotorCurve* out);
+
+/**
+ * @brief Returns the total duration of a sweep on `channel` in milliseconds.
+ */
+uint32_t MotorCal_durationMs(uint8_t channel);
+
+/**
+ * @brief Starts a characterisation sweep.
+ *
+ * @param channel Pump channel; MotorCal_available() must be true.
+ * @param nowMs   Current `millis()` time.
+ * @return Duty to apply first.
+ */
+uint16_t MotorCal_begin(uint8_t channel, uint32_t nowMs);
+
+/**
+ * @brief Samples feedback and advances the sweep.
+ *
+ * Must be called every CAL_TICK_MS while the sweep runs. On CAL_DONE the
+ * new curve is already active and persisted.
+ *
+ * @param channel      Pump channel.
+ * @param nowMs        Current `millis()` time.
+ * @param duty         Receives the duty to apply while CAL_RUNNING.
+ * @param dripPeriodMs Receives the drip burst period to run instead of
+ *                     `duty` during the drip sweep; 0 otherwise.
+ */
+MotorCalResult MotorCal_update(uint8_t channel, uint32_t nowMs, uint16_t* duty, uint32_t* dripPeriodMs);
+
+/**
+ * @brief Abandons a running sweep, keeping the previous curve.
+ */
+void MotorCal_abort(uint8_t channel);
+
+#endif // MOTORCALIBRATION_H
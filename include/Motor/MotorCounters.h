@@ -0,0 +1,93 @@
+/**
+ * @file MotorCounters.h
+ * @brief Delivered-dose accumulator and lifetime motor counters.
+ *
+ * Counters are accumulated in RAM by TaskMotor and flushed to NVS
+ * (namespace `motorstat`) in batches, preferably while the motor is idle,
+ * to keep flash wear low. Session counters live in RTC memory and survive
+ * the deep sleep entered by `Power_requestShutdown()`; they reset on a cold
+ * boot.
+ *
+ * Only TaskMotor may call the `MotorCounters_add*()` functions; any task may
+ * read a snapshot with `MotorCounters_get()`.
+ */
+#ifndef MOTORCOUNTERS_H
+#define MOTORCOUNTERS_H
+
+#include <stdint.h>
+
+/** @brief Minimum time between two non-forced NVS flushes. */
+static constexpr uint32_t COUNTERS_FLUSH_MIN_INTERVAL_MS = 10UL * 60UL * 1000UL;
+
+/**
+ * @brief Maximum time unflushed counters may stay in RAM.
+ *
+ * Past this age a flush is performed even while the motor is running.
+ */
+static constexpr uint32_t COUNTERS_FLUSH_MAX_INTERVAL_MS = 60UL * 60UL * 1000UL;
+
+/** @brief Cumulative motor usage counters. */
+struct MotorCounters
+{
+    uint32_t pulses;         ///< Drip pulses delivered.
+    uint64_t onMs;           ///< Total time with non-zero motor duty (ms).
+    uint32_t cleaningCycles; ///< Completed cleaning ON/OFF cycles.
+    uint32_t purgeSeconds;   ///< Total purge run time (s).
+};
+
+/**
+ * @brief Loads the lifetime counters from NVS.
+ *
+ * Must be called once from `TaskMotor_init()` before the motor task starts.
+ */
+void MotorCounters_init();
+
+/** @brief Records one delivered drip pulse. */
+void MotorCounters_addPulse();
+
+/**
+ * @brief Adds motor ON time.
+ *
+ * @param ms Milliseconds the motor output was non-zero.
+ */
+void MotorCounters_addOnTime(uint32_t ms);
+
+/** @brief Records one completed cleaning ON/OFF cycle. */
+void MotorCounters_addCleaningCycle();
+
+/**
+ * @brief Adds purge run time.
+ *
+ * @param ms Purge duration in milliseconds. Sub-second remainders are
+ *           carried over to the next call.
+ */
+void MotorCounters_addPurgeTime(uint32_t ms);
+
+/**
+ * @brief Applies the wear-aware flush policy.
+ *
+ * Pending counters are written when the motor is idle and at least
+ * COUNTERS_FLUSH_MIN_INTERVAL_MS has passed since the last flush, or
+ * unconditionally once COUNTERS_FLUSH_MAX_INTERVAL_MS has passed.
+ *
+ * @param motorIdle True when no motor operation is active.
+ */
+void MotorCounters_service(bool motorIdle);
+
+/**
+ * @brief Writes pending counters to NVS immediately if any are pending.
+ *
+ * Used before entering deep sleep.
+ */
+void MotorCounters_flush();
+
+/**
+ * @brief Copies a consistent snapshot of the counters.
+ *
+ * @param session  Counters since the last cold boot; may be nullptr.
+ * @param lifetime Counters over the device lifetime, including values not
+ *                 yet flushed; may be nullptr.
+ */
+void MotorCounters_get(MotorCounters* session, MotorCounters* lifetime);
+
+#endif // MOTORCOUNTERS_H
@@ -0,0 +1,76 @@
+/**
+ * @file MotorStatus.h
+ * @brief Lock-free motor status snapshot for the UI.
+ *
+ * TaskMotor publishes one `MotorStatus` per pump channel after every state
+ * change, each through its own sequence lock. Readers never block the
+ * motor path and never touch a queue: `MotorStatus_get()` copies the
+ * snapshot in constant time and retries only if a publish raced with the
+ * copy.
+ */
+#ifndef MOTORSTATUS_H
+#define MOTORSTATUS_H
+
+#include "Config/config.h"
+#include "Config/pins.h"
+#include <stdint.h>
+
+/** @brief Operation currently driven by TaskMotor. */
+typedef enum : uint8_t
+{
+    MOTOR_MODE_IDLE,       /**< Motor stopped */
+    MOTOR_MODE_CONTINUOUS, /**< Continuous PWM from MOTOR_CMD_SET_SPEED */
+    MOTOR_MODE_DRIP,       /**< Drip burst generator */
+    MOTOR_MODE_CLEANING,   /**< Cleaning ON/OFF sequence */
+    MOTOR_MODE_PURGE,      /**< Purge / priming run */
+    MOTOR_MODE_CALIBRATING /**< Characterisation sweep */
+}MotorMode;
+
+/** @brief Phase within the current operation. */
+typedef enum : uint8_t
+{
+    MOTOR_PHASE_NONE, /**< No operation */
+    MOTOR_PHASE_ON,   /**< Motor driven */
+    MOTOR_PHASE_OFF,  /**< Motor idle between bursts or cycles */
+    MOTOR_PHASE_RAMP  /**< Purge ramping up to its target speed */
+}MotorPhase;
+
+/** @brief Consistent snapshot of the motor state. */
+struct MotorStatus
+{
+    MotorMode    mode;            ///< Current operation.
+    MotorPhase   phase;           ///< Phase within the operation.
+    MotorCmdType source;          ///< Command that started the operation.
+    bool         paused;          ///< True while frozen by MOTOR_CMD_PAUSE.
+    uint8_t      cyclesLeft;      ///< Remaining cleaning cycles.
+    uint8_t      cyclesTotal;     ///< Cycles of the running cleaning profile.
+    uint16_t     dripPerMin;      ///< Drip pulse rate; 0 when not dripping.
+    uint16_t     duty;            ///< LEDC duty currently applied (0–MAX_DUTY).
+    uint32_t     remainingMs;     ///< Time until the operation ends; 0 when untimed.
+    uint32_t     totalMs;         ///< Full duration of the operation; 0 when untimed.
+    uint32_t     pulses;          ///< Drip pulses delivered in the current run.
+    uint32_t     lastPurgeMs;     ///< Run time of the last finished purge.
+    bool         lastPurgePrimed; ///< True if the last purge ended on line-full detection.
+};
+
+/**
+ * @brief Publishes a new snapshot. Only TaskMotor may call this.
+ *
+ * `remainingMs` is taken as of the call; readers see it count down until
+ * the next publish unless `paused` is set.
+ *
+ * @param channel Pump channel the snapshot describes.
+ * @param status  Snapshot to publish.
+ */
+void MotorStatus_publish(uint8_t channel, const MotorStatus& status);
+
+/**
+ * @brief Copies the latest snapshot. Safe from any task; never blocks.
+ *
+ * @param channel Pump channel (0 … MOTOR_CHANNEL_COUNT-1); an out-of-range
+ *                channel reads as idle.
+ * @param out     Destination; `remainingMs` is adjusted to the time of the call.
+ */
+void MotorStatus_get(uint8_t channel, MotorStatus* out);
+
+#endif // MOTORSTATUS_H
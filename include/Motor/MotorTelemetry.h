@@ -0,0 +1,89 @@
+/**
+ * @file MotorTelemetry.h
+ * @brief Per-pulse motor telemetry ring buffer.
+ *
+ * TaskMotor appends a fixed-size binary record for every drip pulse,
+ * cleaning phase change and kickstart on any pump channel. A single
+ * consumer (TaskTelemetry) drains the buffer without ever blocking the
+ * producers: when the buffer is full new records are dropped and counted,
+ * and the per-record sequence number lets the host detect the gap.
+ */
+#ifndef MOTORTELEMETRY_H
+#define MOTORTELEMETRY_H
+
+#include "Config/config.h"
+#include "Config/pins.h"
+#include <stdint.h>
+
+/** @brief Ring buffer capacity in records. Must be a power of two. */
+static constexpr uint32_t TELEMETRY_CAPACITY = 256;
+
+static_assert((TELEMETRY_CAPACITY & (TELEMETRY_CAPACITY - 1)) == 0,
+              "TELEMETRY_CAPACITY must be a power of two");
+
+static_assert(MOTOR_CHANNEL_COUNT <= 16, "the channel number is packed into 4 bits of MotorTelemetryRecord::kind");
+
+/**
+ * @brief `latenessUs` of an event that had no scheduled time, such as the
+ *        start of an operation; not a lateness sample.
+ */
+static constexpr int32_t TELEMETRY_LATENESS_NONE = INT32_MIN;
+
+/** @brief Event kinds carried by a telemetry record. */
+typedef enum : uint8_t
+{
+    TELEMETRY_DRIP_PULSE = 0, /**< Drip burst started */
+    TELEMETRY_CLEAN_ON   = 1, /**< Cleaning ON phase started */
+    TELEMETRY_CLEAN_OFF  = 2, /**< Cleaning OFF phase started */
+    TELEMETRY_KICKSTART  = 3, /**< Kickstart boost applied */
+    TELEMETRY_PURGE_END  = 4, /**< Purge finished; `onWidthMs` holds its run time (saturated), `duty` is 1 if the line was primed */
+    TELEMETRY_CAL_PULSE  = 5, /**< Characterisation drip-sweep burst; not a dose */
+}MotorTelemetryKind;
+
+/**
+ * @brief One telemetry record, 16 bytes, little-endian on the wire.
+ */
+struct MotorTelemetryRecord
+{
+    uint32_t timestampUs; ///< Capture time, low 32 bits of `micros()`.
+    int32_t  latenessUs;  ///< Actual minus scheduled start time (µs); TELEMETRY_LATENESS_NONE if unscheduled.
+    uint16_t duty;        ///< LEDC duty applied (0–MAX_DUTY).
+    uint16_t onWidthMs;   ///< Scheduled ON width of this phase (ms).
+    uint8_t  kind;        ///< MotorTelemetryKind in bits 0–3, pump channel in bits 4–7.
+    uint8_t  source;      ///< MotorCmdType that started the operation.
+    uint16_t seq;         ///< Producer sequence number, wraps at 65536.
+};
+
+static_assert(sizeof(MotorTelemetryRecord) == 16, "MotorTelemetryRecord must stay 16 bytes");
+
+/**
+ * @brief Appends a record. Never blocks; drops the record when full.
+ *
+ * @param channel     Pump channel the event occurred on.
+ * @param kind        Event kind.
+ * @param duty        LEDC duty applied.
+ * @param onWidthMs   Scheduled ON width (ms).
+ * @param latenessUs  Lateness against the scheduled deadline (µs), or
+ *                    TELEMETRY_LATENESS_NONE.
+ * @param source      Command that started the running operation.
+ */
+void MotorTelemetry_record(uint8_t channel, MotorTelemetryKind kind, uint16_t duty,
+                           uint16_t onWidthMs, int32_t latenessUs, MotorCmdType source);
+
+/**
+ * @brief Copies up to `maxRecords` records out of the buffer.
+ *
+ * Must only be called from a single consumer task.
+ *
+ * @param out        Destination array.
+ * @param maxRecords Capacity of `out`.
+ * @return Number of records copied.
+ */
+uint32_t MotorTelemetry_read(MotorTelemetryRecord* out, uint32_t maxRecords);
+
+/**
+ * @brief Returns the number of records dropped because the buffer was full.
+ */
+uint32_t MotorTelemetry_dropped();
+
+#endif // MOTORTELEMETRY_H
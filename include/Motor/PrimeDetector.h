@@ -0,0 +1,67 @@
+/**
+ * @file PrimeDetector.h
+ * @brief End-of-line ("line is full") detection for purge and priming.
+ *
+ * Two detection sources are supported, selected by which pins are fitted
+ * in pins.h:
+ * - **Line sensor** (`PIN_LINE_SENSOR`): an active-low input that asserts
+ *   when liquid reaches the outlet.
+ * - **Current signature** (`PIN_MOTOR_CURRENT`): the pump draws a different
+ *   current once it moves liquid instead of air. After the ramp has settled
+ *   a baseline is learned, and a sustained relative change from it is
+ *   reported as primed.
+ *
+ * The line sensor takes precedence when both are fitted. Each pump channel
+ * has its own inputs and detection state. Only TaskMotor may use this
+ * module.
+ */
+#ifndef PRIMEDETECTOR_H
+#define PRIMEDETECTOR_H
+
+#include <stdint.h>
+
+/** @brief Time after the ramp ends before the current baseline is learned. */
+static constexpr uint32_t PRIME_SETTLE_MS          = 1000;
+
+/** @brief Window over which the current baseline is averaged. */
+static constexpr uint32_t PRIME_BASELINE_MS        = 1000;
+
+/** @brief Relative current change, in percent of baseline, that indicates liquid. */
+static constexpr uint32_t PRIME_CURRENT_CHANGE_PCT = 15;
+
+/** @brief Time a detection condition must hold before it is reported. */
+static constexpr uint32_t PRIME_CONFIRM_MS         = 300;
+
+/**
+ * @brief Configures the detector inputs.
+ *
+ * Must be called once from `TaskMotor_init()`.
+ */
+void PrimeDetector_init();
+
+/**
+ * @brief Returns true when a line sensor or current sensing is fitted on `channel`.
+ */
+bool PrimeDetector_available(uint8_t channel);
+
+/**
+ * @brief Resets detection state at the start (or resume) of a purge.
+ *
+ * @param channel       Pump channel.
+ * @param nowMs         Current `millis()` time.
+ * @param rampEndMs     `millis()` time at which the speed ramp completes.
+ */
+void PrimeDetector_start(uint8_t channel, uint32_t nowMs, uint32_t rampEndMs);
+
+/**
+ * @brief Samples the inputs and advances detection.
+ *
+ * Must be called periodically while a purge is running.
+ *
+ * @param channel Pump channel.
+ * @param nowMs   Current `millis()` time.
+ * @return True once the line has been confirmed full.
+ */
+bool PrimeDetector_update(uint8_t channel, uint32_t nowMs);
+
+#endif // PRIMEDETECTOR_H
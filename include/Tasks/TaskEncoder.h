@@ -2,6 +2,7 @@
 #define TASK_ENCODER_H
 
 #include "Config/config.h"
+#include "Input/EncoderConfig.h"
 #include <Arduino.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
@@ -11,6 +12,18 @@
  * @brief Encoder management interface.
  */
 
+/**
+ * @brief Decode CLK/DT in the PCNT peripheral (1) or in a GPIO interrupt
+ *        with the table decoder (0).
+ *
+ * The GPIO path is for boards or pin maps where no PCNT unit is free.
+ */
+#ifndef ENCODER_USE_PCNT
+#define ENCODER_USE_PCNT 1
+#endif
+
+/* ENCODER_STEP_MODE, ENCODER_REST_STATES and ENCODER_COUNTS_PER_DETENT live in Input/EncoderConfig.h. */
+
 void TaskEncoder(void *pvParameters);
 void TaskEncoder_init();
 
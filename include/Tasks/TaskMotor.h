@@ -3,7 +3,7 @@
  * @brief Motor control task — public interface.
  *
  * All motor control must go through `xMotorQueue`. No code outside this
- * module may call LEDC functions or motor timers directly.
+ * module may call the motor LEDC channels directly.
  */
 #ifndef TASKMOTOR_H
 #define TASKMOTOR_H
@@ -13,7 +13,6 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <freertos/queue.h>
-#include <freertos/timers.h>
 #include <driver/ledc.h>
 #include <Arduino.h>
 
@@ -21,10 +20,20 @@
    HARDWARE CONFIGURATION
    ========================= */
 
-/** @brief LEDC channel used for motor PWM output. */
-#define MOTOR_PWM_CHANNEL  LEDC_CHANNEL_0
+/**
+ * @brief LEDC channel used for the PWM output of each pump channel.
+ *
+ * LEDC_CHANNEL_1 belongs to the buzzer, LEDC_CHANNEL_5 to the backlight.
+ */
+static constexpr ledc_channel_t MOTOR_PWM_CHANNELS[] = {
+    LEDC_CHANNEL_0, LEDC_CHANNEL_2, LEDC_CHANNEL_3, LEDC_CHANNEL_4
+};
 
-/** @brief LEDC timer used for motor PWM. */
+static_assert(MOTOR_CHANNEL_COUNT >= 1 &&
+              MOTOR_CHANNEL_COUNT <= (int)(sizeof(MOTOR_PWM_CHANNELS) / sizeof(MOTOR_PWM_CHANNELS[0])),
+              "MOTOR_CHANNEL_COUNT exceeds the LEDC channels reserved for motors");
+
+/** @brief LEDC timer shared by all motor PWM channels. */
 #define MOTOR_PWM_TIMER    LEDC_TIMER_0
 
 /** @brief Maximum LEDC duty value at 10-bit resolution (2^10 - 1 = 1023). */
@@ -39,7 +48,7 @@
 static constexpr uint32_t KICKSTART_MS = 350;
 
 /**
- * @brief Initializes motor PWM peripheral, software timers, and control task.
+ * @brief Initializes the motor PWM channels and the control task.
  *
  * Must be called once during system startup, after `Config_init()`.
  */
@@ -48,10 +57,15 @@ void TaskMotor_init();
 /**
  * @brief Motor control task.
  *
- * Drains `xMotorQueue` and dispatches each command to the appropriate
- * handler. Supported commands: MOTOR_CMD_SET_SPEED, MOTOR_CMD_START_TIMED,
+ * Drains `xMotorQueue` and dispatches each command to the pump channel it
+ * addresses (or to every channel for MOTOR_CHANNEL_ALL). Between commands
+ * the task sleeps until the earliest pending phase change of any channel.
+ * Supported commands: MOTOR_CMD_SET_SPEED, MOTOR_CMD_START_TIMED,
  * MOTOR_CMD_STOP, MOTOR_CMD_CLEAN_FAST, MOTOR_CMD_CLEAN_SLOW,
- * MOTOR_CMD_CLEAN_MANUAL, MOTOR_CMD_CLEAN_PURGE.
+ * MOTOR_CMD_CLEAN_MANUAL, MOTOR_CMD_CLEAN_PURGE, MOTOR_CMD_SHUTDOWN,
+ * MOTOR_CMD_PAUSE, MOTOR_CMD_RESUME, MOTOR_CMD_CHARACTERISE.
+ *
+ * Wakes every few seconds when idle to apply the MotorCounters flush policy.
  *
  * @param pvParameters Unused.
  */
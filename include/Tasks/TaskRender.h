@@ -0,0 +1,43 @@
+/**
+ * @file TaskRender.h
+ * @brief Display render task interface.
+ *
+ * Owns the TFT. Wakes when the UI model changes and redraws it with
+ * UI_render(), at most once every RENDER_FRAME_PERIOD_MS. Changes made
+ * while a frame is pending are coalesced into that frame, so the input
+ * path never waits for SPI and the screen always shows the newest model.
+ * Screens with live values (the run dashboard) also get a frame when the
+ * delay returned by UI_render() expires.
+ */
+#ifndef TASKRENDER_H
+#define TASKRENDER_H
+
+#include "UI/UIState.h"
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+/** @brief Minimum time between two frames in milliseconds (50 Hz). */
+static constexpr uint32_t RENDER_FRAME_PERIOD_MS = 20;
+
+/**
+ * @brief Render task loop.
+ *
+ * @param pvParameters Unused.
+ */
+void TaskRender(void *pvParameters);
+
+/**
+ * @brief Creates the render task, which initialises the TFT.
+ *
+ * Must be called once during system init, right after TaskUI_init(), so
+ * the display comes up while the other subsystems start.
+ */
+void TaskRender_init();
+
+/**
+ * @brief Asks for a frame. Safe to call from any task, and before TaskRender_init().
+ */
+void TaskRender_requestFrame();
+
+#endif // TASKRENDER_H
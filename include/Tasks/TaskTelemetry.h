@@ -0,0 +1,36 @@
+/**
+ * @file TaskTelemetry.h
+ * @brief Motor telemetry streaming task interface.
+ *
+ * Drains the MotorTelemetry ring buffer and streams it over USB-CDC as
+ * binary frames: a two-byte sync word (`0xA5 0x5A`) followed by one
+ * 16-byte `MotorTelemetryRecord`. Frames are discarded while no host is
+ * attached so the buffer always holds recent data.
+ */
+#ifndef TASKTELEMETRY_H
+#define TASKTELEMETRY_H
+
+#include "Config/config.h"
+#include "Motor/MotorTelemetry.h"
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+/** @brief Ring buffer drain period in milliseconds. */
+static constexpr uint32_t TELEMETRY_DRAIN_PERIOD_MS = 50;
+
+/**
+ * @brief Telemetry streaming task loop.
+ *
+ * @param pvParameters Unused.
+ */
+void TaskTelemetry(void *pvParameters);
+
+/**
+ * @brief Starts USB-CDC and creates the telemetry streaming task.
+ *
+ * Must be called once during system init.
+ */
+void TaskTelemetry_init();
+
+#endif // TASKTELEMETRY_H
@@ -0,0 +1,121 @@
+/**
+ * @file Backlight.h
+ * @brief PWM backlight with idle dimming and blanking.
+ *
+ * The backlight is driven by its own LEDC channel and timer. After
+ * BACKLIGHT_DIM_AFTER_MS without input it drops to BACKLIGHT_DIM_PERCENT,
+ * after BACKLIGHT_OFF_AFTER_MS it goes dark. The next input event brings
+ * it straight back to full brightness and is consumed by the wake-up, so
+ * a click or turn on a dark screen never changes anything behind it. The
+ * rest of the same button press (hold, repeats) and rotations within
+ * BACKLIGHT_WAKE_GUARD_MS are consumed as well.
+ *
+ * Backlight_onInput() and Backlight_tick() belong to TaskUI; the other
+ * functions may be called from any task. Backlight_wake() notifies TaskUI
+ * so the idle timeouts start from the moment the light comes on.
+ */
+#ifndef BACKLIGHT_H
+#define BACKLIGHT_H
+
+#include "Config/config.h"
+#include <driver/ledc.h>
+#include <freertos/task.h>
+#include <stdint.h>
+
+/* =========================
+   HARDWARE CONFIGURATION
+   ========================= */
+
+/** @brief LEDC channel of the backlight. Channels 0–4 belong to motors and buzzer. */
+#define BACKLIGHT_PWM_CHANNEL    LEDC_CHANNEL_5
+
+/** @brief LEDC timer of the backlight. */
+#define BACKLIGHT_PWM_TIMER      LEDC_TIMER_2
+
+/** @brief 10-bit PWM resolution (duty range 0–1023). */
+#define BACKLIGHT_RESOLUTION     LEDC_TIMER_10_BIT
+
+/** @brief PWM frequency; well above visible flicker and below the LED driver's limit. */
+#define BACKLIGHT_PWM_FREQ_HZ    5000
+
+/* =========================
+   IDLE POLICY
+   ========================= */
+
+/** @brief Brightness while the user is interacting, in percent. */
+static constexpr uint8_t  BACKLIGHT_FULL_PERCENT  = 100;
+
+/** @brief Brightness after the dim timeout, in percent. */
+static constexpr uint8_t  BACKLIGHT_DIM_PERCENT   = 15;
+
+/** @brief Time without input before the backlight dims. */
+static constexpr uint32_t BACKLIGHT_DIM_AFTER_MS  = 30 * 1000;
+
+/** @brief Time without input before the backlight turns off. */
+static constexpr uint32_t BACKLIGHT_OFF_AFTER_MS  = 2 * 60 * 1000;
+
+/** @brief Rotations this soon after a wake-up are consumed with it. */
+static constexpr uint32_t BACKLIGHT_WAKE_GUARD_MS = 300;
+
+static_assert(BACKLIGHT_DIM_AFTER_MS < BACKLIGHT_OFF_AFTER_MS,
+              "the backlight must dim before it turns off");
+
+/** @brief Backlight brightness steps. */
+typedef enum : uint8_t
+{
+    BACKLIGHT_OFF,  /**< Dark */
+    BACKLIGHT_DIM,  /**< BACKLIGHT_DIM_PERCENT */
+    BACKLIGHT_FULL  /**< BACKLIGHT_FULL_PERCENT */
+}BacklightLevel;
+
+/**
+ * @brief Configures the LEDC channel with the backlight off.
+ *
+ * Must be called once from UI_init(), before the first frame.
+ */
+void Backlight_init();
+
+/**
+ * @brief Sets the task that runs Backlight_tick(), woken by Backlight_wake().
+ *
+ * Must be called before the first Backlight_wake().
+ */
+void Backlight_setTimerTask(TaskHandle_t task);
+
+/**
+ * @brief Turns the backlight on at full brightness and restarts the idle timer.
+ *
+ * Called once the first frame is on screen, so driver start-up noise is never shown.
+ * Wakes the timer task, which may be sleeping without a deadline while the
+ * light is off.
+ */
+void Backlight_wake();
+
+/**
+ * @brief Turns the backlight off for good, e.g. before deep sleep.
+ */
+void Backlight_off();
+
+/**
+ * @brief Returns the current brightness step.
+ */
+BacklightLevel Backlight_level();
+
+/**
+ * @brief Records user activity.
+ *
+ * @param evt Input event about to be dispatched.
+ * @return true if the event woke the screen, or belongs to the action that
+ *         did, and must not reach the UI.
+ */
+bool Backlight_onInput(const InputEvent& evt);
+
+/**
+ * @brief Applies the idle timeouts.
+ *
+ * @param nowMs Current `millis()`.
+ * @return Milliseconds until the next brightness step; UINT32_MAX when dark.
+ */
+uint32_t Backlight_tick(uint32_t nowMs);
+
+#endif // BACKLIGHT_H
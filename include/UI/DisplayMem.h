@@ -0,0 +1,51 @@
+/**
+ * @file DisplayMem.h
+ * @brief Accounting and admission control for display buffers.
+ *
+ * Screen-specific buffers (glyph tiles, renderer canvases) are allocated
+ * when a screen is entered and released when it is left. Every such buffer
+ * goes through this module, which refuses an allocation that would leave
+ * less than DISPLAY_MEM_MIN_FREE bytes of heap, so the display never
+ * starves the other tasks. Callers fall back to drawing straight from the
+ * font or asset when refused.
+ *
+ * The peak is logged whenever it grows and can be read back.
+ */
+#ifndef DISPLAYMEM_H
+#define DISPLAYMEM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** @brief Heap that must stay free after any display allocation. */
+static constexpr size_t DISPLAY_MEM_MIN_FREE = 48 * 1024;
+
+/**
+ * @brief Allocates a display buffer.
+ *
+ * @return The buffer, or nullptr if it would take the heap below DISPLAY_MEM_MIN_FREE.
+ */
+void* DisplayMem_alloc(size_t bytes);
+
+/**
+ * @brief Frees a buffer from DisplayMem_alloc(). `bytes` must match the request.
+ */
+void DisplayMem_free(void* buffer, size_t bytes);
+
+/**
+ * @brief Returns true if `bytes` more may be allocated by someone else, e.g. TFT_eSprite.
+ */
+bool DisplayMem_canAllocate(size_t bytes);
+
+/**
+ * @brief Records a buffer allocated outside this module; negative when it is freed.
+ */
+void DisplayMem_account(int32_t bytes);
+
+/** @brief Returns the bytes currently held by display buffers. */
+size_t DisplayMem_inUse();
+
+/** @brief Returns the most bytes ever held by display buffers at once. */
+size_t DisplayMem_peak();
+
+#endif // DISPLAYMEM_H
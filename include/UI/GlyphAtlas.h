@@ -0,0 +1,97 @@
+/**
+ * @file GlyphAtlas.h
+ * @brief Pre-rendered 1-bit glyph tiles for the value fields.
+ *
+ * Rasterising a scaled GFX free font walks the glyph bitmap bit by bit and
+ * issues a fill per set bit. The value fields only ever show digits and a
+ * few fixed labels, so each field's glyphs are rendered once, with
+ * the field's font, size and colour, and cropped to their ink. Drawing a
+ * string then only copies the tiles into the renderer canvas.
+ *
+ * Strings are laid out exactly as `TFT_eSPI::drawString()` lays them out:
+ * each glyph is placed at the running sum of advances, and the width of a
+ * string follows `textWidth()`. Free fonts are not anti-aliased, so a tile
+ * only records which pixels are inked, one bit each, and the atlas holds
+ * the single ink colour. Only ink is copied, so overlapping ink of
+ * neighbouring glyphs survives.
+ *
+ * Characters that were not in the atlas at build time are skipped.
+ *
+ * Tiles come from DisplayMem, so an atlas is built when its screen is
+ * entered and released when the screen is left.
+ */
+#ifndef GLYPHATLAS_H
+#define GLYPHATLAS_H
+
+#include <TFT_eSPI.h>
+#include <stdint.h>
+
+/** @brief Maximum number of distinct characters in one atlas. */
+static constexpr uint8_t GLYPH_ATLAS_MAX_GLYPHS = 24;
+
+/** @brief One pre-rendered glyph. */
+struct AtlasGlyph
+{
+    char      code;      ///< Character.
+    int16_t   advance;   ///< Cursor advance in pixels.
+    int16_t   lastWidth; ///< Width the glyph adds to textWidth() as the last character.
+    int16_t   dx;        ///< Tile left edge relative to the cursor.
+    int16_t   dy;        ///< Tile top edge relative to the text's middle line.
+    uint16_t  w;         ///< Tile width; 0 for glyphs without ink.
+    uint16_t  h;         ///< Tile height.
+    uint8_t*  bits;      ///< `h` rows of `(w + 7) / 8` bytes, MSB first; set bits are ink.
+};
+
+/** @brief Glyph tiles of one font, size and colour. */
+struct GlyphAtlas
+{
+    bool       ready;                          ///< True once built, false after release.
+    int16_t    height;                         ///< fontHeight() of the font at this size.
+    uint16_t   color;                          ///< Ink colour in sprite byte order.
+    uint8_t    count;                          ///< Number of glyphs held.
+    AtlasGlyph glyphs[GLYPH_ATLAS_MAX_GLYPHS]; ///< Glyphs in build order.
+};
+
+/**
+ * @brief Renders every character used by `texts` into `atlas`.
+ *
+ * Fails without holding any memory when DisplayMem refuses the tiles or
+ * the scratch sprite.
+ *
+ * @param atlas    Atlas to fill.
+ * @param tft      Display the temporary render sprite belongs to.
+ * @param font     Free font.
+ * @param textSize Text size multiplier.
+ * @param color    Text colour.
+ * @param texts    Strings whose characters the atlas must cover.
+ * @param count    Number of strings.
+ * @return True if the atlas is ready.
+ */
+bool GlyphAtlas_build(GlyphAtlas* atlas, TFT_eSPI* tft, const GFXfont* font, uint8_t textSize,
+                      uint16_t color, const char* const* texts, uint8_t count);
+
+/**
+ * @brief Frees the tiles of an atlas. Safe on an atlas that is not built.
+ */
+void GlyphAtlas_release(GlyphAtlas* atlas);
+
+/**
+ * @brief Returns the width of the first `len` characters of `text`, as textWidth() would.
+ */
+int16_t GlyphAtlas_textWidth(const GlyphAtlas* atlas, const char* text, size_t len);
+
+/**
+ * @brief Copies the tiles of `text` into a sprite.
+ *
+ * A 16-bit sprite receives the ink colour; a 1-bit sprite gets its ink
+ * bits set, to be expanded by the renderer's palette.
+ *
+ * @param atlas Atlas holding the glyphs.
+ * @param dst   Destination sprite; tiles are clipped to it.
+ * @param text  String to draw.
+ * @param x     Left edge of the string (cursor start).
+ * @param midY  Middle line of the string, as for an `M*_DATUM`.
+ */
+void GlyphAtlas_draw(const GlyphAtlas* atlas, TFT_eSprite& dst, const char* text, int16_t x, int16_t midY);
+
+#endif // GLYPHATLAS_H
@@ -0,0 +1,120 @@
+/**
+ * @file Icon.h
+ * @brief Packed icons and their streaming decoder.
+ *
+ * Icons are generated into `src/images/icons.cpp` from the PNGs in
+ * `src/images/icons/` by `scripts/build_assets.py`, in one of three
+ * encodings. Pixels are always in raster order:
+ *
+ * - ICON_ENCODING_RAW: RGB565, two bytes per pixel, little-endian.
+ * - ICON_ENCODING_PALETTE: palette indices of `indexBits` (1, 2, 4 or 8)
+ *   bits, packed MSB first; rows are not padded.
+ * - ICON_ENCODING_RLE: runs continuing across row ends, one byte each:
+ *
+ *       [ palette index : indexBits ][ length : 8 - indexBits ]
+ *
+ *   A length field of 0 means the real length is `2^(8 - indexBits)` plus
+ *   the following byte. Longer runs are split.
+ *
+ * The decoder hands out runs, so drawing never expands an icon into a
+ * full-size buffer: sprites are filled run by run, and the TFT is fed one
+ * line at a time.
+ */
+#ifndef ICON_H
+#define ICON_H
+
+#include <TFT_eSPI.h>
+#include <stdint.h>
+
+/** @brief Widest icon Icon_push() can stream. */
+static constexpr uint16_t ICON_MAX_WIDTH = 128;
+
+/** @brief Pixel data layout of a PackedIcon. */
+typedef enum : uint8_t
+{
+    ICON_ENCODING_RAW,     /**< RGB565 pixels */
+    ICON_ENCODING_PALETTE, /**< Packed palette indices */
+    ICON_ENCODING_RLE      /**< Runs of palette indices */
+}IconEncoding;
+
+/** @brief A packed icon in flash. */
+struct PackedIcon
+{
+    uint16_t        width;       ///< Width in pixels.
+    uint16_t        height;      ///< Height in pixels.
+    IconEncoding    encoding;    ///< Layout of `data`.
+    uint8_t         indexBits;   ///< Bits per palette index; unused for RAW.
+    const uint16_t* palette;     ///< RGB565 colours; nullptr for RAW.
+    uint16_t        colors;      ///< Entries in `palette`; 0 for RAW.
+    const uint8_t*  data;        ///< Pixel data.
+};
+
+/** @brief Streaming decoder state. */
+struct IconDecoder
+{
+    const PackedIcon* icon;    ///< Icon being decoded.
+    uint32_t          pos;     ///< Next byte in `data`.
+    uint16_t          color;   ///< Colour of the current run.
+    uint8_t           index;   ///< Palette index of the current run; 0 for RAW.
+    uint16_t          runLeft; ///< Pixels left in the current run.
+};
+
+/**
+ * @brief Starts decoding `icon` from its first pixel.
+ */
+void IconDecoder_init(IconDecoder* dec, const PackedIcon* icon);
+
+/**
+ * @brief Returns the next run of identical pixels, at most `limit` long.
+ *
+ * @param dec   Decoder.
+ * @param limit Maximum pixels to take, e.g. what is left of the row.
+ * @param color Receives the run's colour.
+ * @return Pixels taken.
+ */
+uint16_t IconDecoder_next(IconDecoder* dec, uint16_t limit, uint16_t* color);
+
+/**
+ * @brief Draws an icon into a 16-bit sprite, clipped to it.
+ *
+ * @param icon        Icon to draw.
+ * @param dst         Destination sprite.
+ * @param x           Left edge in sprite coordinates.
+ * @param y           Top edge in sprite coordinates.
+ * @param transparent Colour that is not drawn.
+ */
+void Icon_drawToSprite(const PackedIcon* icon, TFT_eSprite& dst, int16_t x, int16_t y, uint16_t transparent);
+
+/**
+ * @brief Draws an icon into an 8-bit sprite as palette indices, clipped to it.
+ *
+ * Pixels are written as `firstIndex` plus their index in the icon's
+ * palette, for a canvas whose palette holds the icon's colours from
+ * `firstIndex` on (see Renderer_flushIndexed()). The icon must not be RAW.
+ *
+ * @param icon        Icon to draw.
+ * @param dst         Destination sprite, 8 bits per pixel.
+ * @param x           Left edge in sprite coordinates.
+ * @param y           Top edge in sprite coordinates.
+ * @param transparent Colour that is not drawn.
+ * @param firstIndex  Canvas index of the icon's first palette entry.
+ */
+void Icon_drawIndexed(const PackedIcon* icon, TFT_eSprite& dst, int16_t x, int16_t y,
+                      uint16_t transparent, uint8_t firstIndex);
+
+/**
+ * @brief Streams an icon straight into a TFT window, one line at a time.
+ *
+ * The icon must lie fully on screen. The caller owns the SPI bus.
+ *
+ * @param tft         Display.
+ * @param x           Left edge.
+ * @param y           Top edge.
+ * @param icon        Icon to draw; at most ICON_MAX_WIDTH wide.
+ * @param transparent Colour replaced by `background`.
+ * @param background  Colour already on screen behind the icon.
+ */
+void Icon_push(TFT_eSPI& tft, int16_t x, int16_t y, const PackedIcon* icon,
+               uint16_t transparent, uint16_t background);
+
+#endif // ICON_H
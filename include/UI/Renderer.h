@@ -0,0 +1,188 @@
+/**
+ * @file Renderer.h
+ * @brief Dirty-rectangle renderer with DMA pushes to the TFT.
+ *
+ * Screen updates are described as dirty rectangles. On flush, each
+ * rectangle is composed band by band into a small off-screen canvas by a
+ * paint callback and sent with `pushImageDMA()`. Two canvases alternate, so
+ * the next band is composed while the previous one is still on the bus.
+ * Only the dirty pixels cross SPI, and every pixel is written once, so
+ * nothing flickers.
+ *
+ * The paint callback draws in screen coordinates shifted by the band
+ * origin (`x - originX`, `y - originY`); the canvas clips everything outside
+ * the band. A painter may therefore simply draw its whole widget or screen.
+ *
+ * Most widgets use two or three colours, so a flush may compose into
+ * paletted canvases instead (Renderer_flushIndexed()): 8-bit palette
+ * indices or 1 bit per pixel. They take a half or a sixteenth of the RAM
+ * of an RGB565 band. Before sending, a few rows at a time are expanded
+ * through the palette into one of two small line buffers, and each chunk
+ * is pushed with DMA while the next one is expanded.
+ *
+ * The last DMA transfer is left running when Renderer_flush() returns. Call
+ * Renderer_sync() before drawing on the TFT directly.
+ *
+ * Only the render task may use this module.
+ */
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#include <TFT_eSPI.h>
+#include <stdint.h>
+
+/** @brief Canvas capacity in pixels; a band holds at most this many. */
+static constexpr int32_t RENDER_CANVAS_PIXELS = 160 * 24;
+
+/** @brief Dirty rectangles tracked before they are merged into one. */
+static constexpr uint8_t RENDER_MAX_DIRTY = 4;
+
+/** @brief Rows of a paletted band expanded to RGB565 per DMA transfer. */
+static constexpr int16_t RENDER_EXPAND_LINES = 4;
+
+/** @brief Set to true to log the canvas format benchmark at boot (UI_benchmarkRender()). */
+static constexpr bool    RENDER_BENCHMARK = false;
+
+/** @brief Pixel format of the band canvases. */
+typedef enum : uint8_t
+{
+    RENDER_RGB565,   /**< 16 bits per pixel, pushed as composed */
+    RENDER_INDEXED8, /**< 8-bit palette indices, drawn as Renderer_index() */
+    RENDER_MONO1     /**< 1 bit per pixel: black is palette entry 0, any other colour entry 1 */
+}RenderFormat;
+
+/** @brief RAM and time of one benchmarked flush. */
+struct RenderBench
+{
+    uint32_t canvasBytes; ///< Both canvases at their largest during the flush.
+    uint32_t expandBytes; ///< Line buffers used for expansion; 0 for RGB565.
+    uint32_t flushUs;     ///< Average compose-and-push time, DMA included.
+    uint32_t sentBytes;   ///< Bytes sent to the panel per flush.
+};
+
+/** @brief Screen rectangle. Empty when `w` or `h` is not positive. */
+struct Rect
+{
+    int16_t x; ///< Left edge.
+    int16_t y; ///< Top edge.
+    int16_t w; ///< Width.
+    int16_t h; ///< Height.
+};
+
+/** @brief Returns true if `r` covers no pixel. */
+static inline bool Rect_isEmpty(const Rect& r)
+{
+    return r.w <= 0 || r.h <= 0;
+}
+
+/** @brief Returns the smallest rectangle covering `a` and `b`. */
+static inline Rect Rect_union(const Rect& a, const Rect& b)
+{
+    if (Rect_isEmpty(a)) return b;
+    if (Rect_isEmpty(b)) return a;
+
+    int16_t x0 = a.x < b.x ? a.x : b.x;
+    int16_t y0 = a.y < b.y ? a.y : b.y;
+    int16_t x1 = (a.x + a.w) > (b.x + b.w) ? (a.x + a.w) : (b.x + b.w);
+    int16_t y1 = (a.y + a.h) > (b.y + b.h) ? (a.y + a.h) : (b.y + b.h);
+
+    return Rect{ x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0) };
+}
+
+/** @brief Returns true if `a` and `b` overlap or share an edge. */
+static inline bool Rect_touches(const Rect& a, const Rect& b)
+{
+    return a.x <= b.x + b.w && b.x <= a.x + a.w &&
+           a.y <= b.y + b.h && b.y <= a.y + a.h;
+}
+
+/**
+ * @brief Paints the part of the screen covered by `canvas`.
+ *
+ * @param canvas  Band being composed.
+ * @param originX Screen x of the canvas' left edge.
+ * @param originY Screen y of the canvas' top edge.
+ * @param ctx     Painter context passed to Renderer_flush().
+ */
+typedef void (*RenderPaintFn)(TFT_eSprite& canvas, int16_t originX, int16_t originY, const void* ctx);
+
+/**
+ * @brief Returns the colour that stores palette index `index` in an 8-bit canvas.
+ *
+ * TFT_eSprite converts every RGB565 colour drawn into an 8-bit sprite to
+ * RGB332; this is the colour that converts to exactly `index`.
+ */
+static inline uint16_t Renderer_index(uint8_t index)
+{
+    return ((index & 0xE0) << 8) | ((index & 0x1C) << 6) | ((index & 0x03) << 3);
+}
+
+/**
+ * @brief Sets up DMA, the canvases and the expansion line buffers.
+ *
+ * Must be called once after `tft->init()` and `setRotation()`.
+ */
+void Renderer_init(TFT_eSPI* tft);
+
+/**
+ * @brief Marks a screen region for repaint on the next flush.
+ */
+void Renderer_invalidate(const Rect& r);
+
+/**
+ * @brief Repaints every dirty rectangle with `paint` and clears the list.
+ */
+void Renderer_flush(RenderPaintFn paint, const void* ctx);
+
+/**
+ * @brief Renderer_flush() into paletted canvases.
+ *
+ * The painter draws palette indices: with Renderer_index() in an 8-bit
+ * canvas, black and any other colour in a 1-bit one. The painter can tell
+ * the format from `canvas.getColorDepth()`.
+ *
+ * @param paint   Painter.
+ * @param ctx     Painter context.
+ * @param format  Canvas format; RENDER_RGB565 behaves as Renderer_flush().
+ * @param palette RGB565 colour of each index; two entries for RENDER_MONO1.
+ * @param colors  Entries in `palette`; indices drawn must be below it.
+ */
+void Renderer_flushIndexed(RenderPaintFn paint, const void* ctx, RenderFormat format,
+                           const uint16_t* palette, uint16_t colors);
+
+/**
+ * @brief Waits for the last DMA transfer and releases the SPI bus.
+ */
+void Renderer_sync();
+
+/**
+ * @brief Sends flushed bands into `frame` instead of the panel; nullptr sends them to the panel again.
+ *
+ * `frame` must be a 16-bit sprite the size of the screen. Used to draw a
+ * screen off-screen for a transition.
+ */
+void Renderer_capture(TFT_eSprite* frame);
+
+/**
+ * @brief Returns the number of bytes sent by the last Renderer_flush().
+ */
+uint32_t Renderer_lastFlushBytes();
+
+/**
+ * @brief Repaints `r` `repeats` times in `format` and reports the cost.
+ *
+ * For comparing canvas formats; the pixels really go to the panel.
+ *
+ * @param r       Area to repaint.
+ * @param paint   Painter.
+ * @param ctx     Painter context.
+ * @param format  Canvas format.
+ * @param palette Palette as for Renderer_flushIndexed(); ignored for RGB565.
+ * @param colors  Entries in `palette`.
+ * @param repeats Flushes to average over.
+ * @param out     Receives the result.
+ */
+void Renderer_measure(const Rect& r, RenderPaintFn paint, const void* ctx, RenderFormat format,
+                      const uint16_t* palette, uint16_t colors, uint8_t repeats, RenderBench* out);
+
+#endif // RENDERER_H
@@ -0,0 +1,94 @@
+/**
+ * @file Transition.h
+ * @brief Animated screen transitions composed off-screen and pushed with DMA.
+ *
+ * Instead of clearing the panel and drawing the new screen piece by piece,
+ * the new screen is drawn into a full-screen frame in RAM, then slid over
+ * the old one in TRANSITION_FRAMES steps at a fixed frame rate. Each step
+ * goes through the renderer, so it is composed band by band and pushed
+ * with DMA while the next band is being copied.
+ *
+ * The panel cannot be read back and only the new frame is held in RAM.
+ * The new screen therefore covers the old one, which does not move.
+ *
+ * The frame is taken from DisplayMem for the duration of one transition.
+ * If it is refused, Transition_begin() fails and the caller draws
+ * directly as before.
+ *
+ * Everything runs in TaskRender and only holds the UI model lock to check
+ * for a newer screen, so input is handled at full rate during a
+ * transition. Transition_noteInput() lets the input path record this.
+ */
+#ifndef TRANSITION_H
+#define TRANSITION_H
+
+#include <TFT_eSPI.h>
+#include <stdint.h>
+
+/** @brief Set to false to build without transitions. */
+static constexpr bool     TRANSITIONS_ENABLED = true;
+
+/** @brief Animation steps per transition. */
+static constexpr uint8_t  TRANSITION_FRAMES   = 8;
+
+/** @brief Time between animation steps in milliseconds. */
+static constexpr uint32_t TRANSITION_FRAME_MS = 20;
+
+/** @brief How the new screen comes in. */
+typedef enum : uint8_t
+{
+    TRANSITION_NONE,        /**< Drawn in place */
+    TRANSITION_SLIDE_LEFT,  /**< Enters from the right; going deeper */
+    TRANSITION_SLIDE_RIGHT  /**< Enters from the left; going back */
+}TransitionType;
+
+/** @brief Transition timings and the input handled meanwhile. */
+struct TransitionStats
+{
+    uint32_t transitions; ///< Transitions started.
+    uint32_t cancelled;   ///< Transitions cut short by a newer screen.
+    uint32_t lastMs;      ///< Duration of the last transition.
+    uint32_t maxFrameUs;  ///< Longest compose-and-push time of one step.
+    uint32_t inputEvents; ///< Input events handled during transitions.
+    uint32_t maxInputUs;  ///< Longest time to handle one of them, lock wait included.
+};
+
+/**
+ * @brief Allocates the frame and redirects drawing into it.
+ *
+ * @param tft Display the frame is created for.
+ * @return The frame to draw the new screen into, or nullptr if memory is
+ *         short; the caller then draws directly.
+ */
+TFT_eSprite* Transition_begin(TFT_eSPI* tft);
+
+/**
+ * @brief Returns the frame while a screen is being captured; nullptr otherwise.
+ */
+TFT_eSprite* Transition_frame();
+
+/**
+ * @brief Animates the captured frame onto the panel and releases it.
+ *
+ * @param type       Animation; TRANSITION_NONE pushes the frame in one step.
+ * @param superseded Polled before each step; returning true stops the
+ *                   animation because a newer screen is waiting.
+ */
+void Transition_run(TransitionType type, bool (*superseded)(void));
+
+/**
+ * @brief Returns true while a transition is animating. Safe from any task.
+ */
+bool Transition_active();
+
+/**
+ * @brief Records the handling time of an input event if a transition is running.
+ */
+void Transition_noteInput(uint32_t handledUs);
+
+/**
+ * @brief Copies the statistics. Safe from any task.
+ */
+void Transition_getStats(TransitionStats* out);
+
+#endif // TRANSITION_H
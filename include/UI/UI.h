@@ -6,17 +6,25 @@
 #define UI_H
 
 #include "Config/config.h"
+#include "UI/Icon.h"
+#include "UI/Transition.h"
+#include "Motor/MotorStatus.h"
 #include <stdint.h>
 
-constexpr int MENU_COUNT = 3;
+/** @brief Menu rows on screen at once; longer menus scroll. */
+constexpr int MENU_VISIBLE_ROWS = 3;
 
 void UI_init();
 
-void UI_drawMenu(const char* const titles[], const uint16_t* const icons[], int items);
-void UI_updateMenuSelection(const char* const* titles, const uint16_t* const* icons, int last, int current, int items);
-void UI_drawIcon(int16_t x, int16_t y, const uint16_t* icon);
+bool UI_beginTransition();
+void UI_endTransition(TransitionType type, bool (*superseded)(void));
 
-void UI_drawConfirmStatic(const char* title, const uint16_t* icon);
+void UI_drawMenuStatic();
+void UI_drawMenuRow(int slot, int rows, const char* title, const PackedIcon* icon, bool selected, bool scrollbar);
+void UI_drawMenuScrollbar(int first, int rows, int count);
+void UI_drawIcon(int16_t x, int16_t y, const PackedIcon* icon);
+
+void UI_drawConfirmStatic(const char* title, const PackedIcon* icon);
 void UI_drawConfirmButtons(int selected);
 
 void UI_drawBootLogo();
@@ -31,4 +39,26 @@ void UI_drawReviewSystem();
 void UI_updateSystemSelect(int index);
 void UI_drawReviewSoft();
 
+void UI_drawRunStatic();
+void UI_updateRun(const MotorStatus& status);
+
+/** @brief Values on the diagnostics screen. */
+struct DiagnosticsView
+{
+    uint32_t pulses;       ///< Lifetime drip pulses.
+    uint32_t pumpHours;    ///< Lifetime motor run time in hours.
+    uint32_t bootMs;       ///< Power-on-to-interactive time of this boot.
+    uint32_t inputDropped; ///< Input events and beeps lost to a full buffer.
+};
+
+void UI_drawDiagnosticsStatic();
+void UI_updateDiagnostics(const DiagnosticsView& view);
+
+/**
+ * @brief Draws menu rows, value text and buttons in every canvas format and logs RAM and push time.
+ *
+ * Draws on the panel; run before the first screen (see RENDER_BENCHMARK).
+ */
+void UI_benchmarkRender();
+
 #endif // UI_H
@@ -3,7 +3,7 @@
  * @brief Declarations for the User Interface (UI) state machine.
  *
  * This module defines the Finite State Machine for the UI menu,
- * lookup tables for menu titles and icons, and utility functions
+ * the constexpr menu descriptions it walks, and utility functions
  * to manage state transitions and encoder events.
  */
 #ifndef UISTATE_H
@@ -36,23 +36,80 @@ static constexpr uint8_t TIME_DEFAULT_INDEX = TIME_OPTION_COUNT - 1;
 
     MENU_POWER_OFF, /**< "Power Off" option */
 
+    MENU_RUN_DASHBOARD,      /**< Live view of a timed drip or cleaning run */
+
+    MENU_START_PRESETS,      /**< Speed presets menu */
+    MENU_CALIBRATE_CONFIRM,  /**< "Calibrate" option */
+    MENU_DIAGNOSTICS,        /**< Counters and system health */
+
     UI_STATE_COUNT           /**< Total number of states */
 };
 
+/**
+ * @struct UIModel
+ * @brief Everything the screen shows. Written by the event path, read by the render task.
+ */
+struct UIModel {
+    UIState  state;          ///< Current screen.
+    uint32_t screenSeq;      ///< Incremented on every state change; forces a full redraw.
+    TransitionType transition; ///< How the current screen is brought in.
+    int      menuIndex;      ///< Highlighted entry of the current menu.
+    int      menuTop;        ///< First menu entry inside the viewport.
+    int      confirmIndex;   ///< Selected confirm button (0 = yes, 1 = no).
+    uint8_t  timeIndex;      ///< Selected entry of the time options.
+    uint8_t  cleanModeIndex; ///< Selected cleaning mode.
+    int      motorSpeed;     ///< Speed set point in percent.
+    UIState  runReturnState; ///< Screen the run dashboard goes back to.
+};
+
+/**
+ * @struct MenuItem
+ * @brief One entry of a menu: what it shows and what a click does.
+ *
+ * A click runs `action` (if any) with `param`, then enters `target` unless
+ * it is UI_STATE_INVALID. When `available` returns false the click only
+ * plays the error beep.
+ */
+struct MenuItem {
+    const char*       title;          ///< Row text.
+    const PackedIcon* icon;           ///< Row icon; nullptr for none.
+    UIState           target;         ///< Screen opened on click.
+    void            (*action)(int);   ///< Run on click before entering `target`.
+    int               param;          ///< Argument of `action`.
+    bool            (*available)();   ///< Whether the entry can be used now; nullptr for always.
+};
+
+/**
+ * @struct MenuDef
+ * @brief A menu of any length. Up to MENU_VISIBLE_ROWS entries are shown; longer menus scroll.
+ */
+struct MenuDef {
+    const MenuItem* items; ///< Entries, top to bottom.
+    uint8_t         count; ///< Number of entries.
+    UIState         back;  ///< Screen opened by a back gesture.
+};
+
 /**
  * @struct UIStateTable
- * @brief Associates a UI state with its event handler.
+ * @brief Associates a UI state with its event handler and render hooks.
+ *
+ * onEnter, handleEvent and onExit only change the model. draw paints the
+ * whole screen; update repaints what differs between `shown` and `model`.
+ * Menu screens set `menu` instead of handleEvent, draw and update.
  */
 struct UIStateTable {
     void (*onEnter)(void);
-    void (*handleEvent)(EncoderEvent evt);
+    void (*handleEvent)(const InputEvent& evt);
     void (*onExit)(void);
+    void (*draw)(const UIModel& model);
+    void (*update)(const UIModel& model, const UIModel& shown);
+    const MenuDef* menu;
 };
 
+void UI_initState();
 void UI_setState(UIState newState);
-void UI_processEvent(EncoderEvent evt);
-
-static_assert(MENU_COUNT == 3, "MENU_COUNT must be 3 to match mainMenu arrays");
+void UI_processEvent(const InputEvent& evt);
+uint32_t UI_render();
 
 void UI_applySettings(const SettingsPayload& data);
 
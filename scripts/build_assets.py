@@ -0,0 +1,377 @@
+#!/usr/bin/env python3
+"""Convert the UI icon PNGs into the packed C arrays read by UI/Icon.h.
+
+The manifest `src/images/icons/assets.json` maps every C symbol to a PNG
+and chooses the encoding:
+    "raw"      RGB565 pixels
+    "palette"  packed palette indices
+    "rle"      palette-indexed runs
+    "auto"     the smallest of the three for each icon
+A single asset may override the global choice with {"file": ..., "encoding": ...}.
+
+Only assets whose symbol appears somewhere under src/ or include/ are
+emitted, so unused icons cost no flash. Identical palettes and identical
+pixel data are stored once. Outputs are rewritten only when their content
+changes, so an unchanged asset set does not trigger a rebuild.
+
+Runs as a PlatformIO pre-build script (`extra_scripts = pre:scripts/build_assets.py`)
+or standalone from the project root:
+    python3 scripts/build_assets.py [--report]
+"""
+
+import json
+import os
+import re
+import struct
+import sys
+import zlib
+
+MANIFEST = os.path.join("src", "images", "icons", "assets.json")
+SCAN_DIRS = ("src", "include")
+SCAN_EXTS = (".c", ".cpp", ".h", ".hpp")
+
+ENCODINGS = ("raw", "palette", "rle")
+
+
+# ---------------------------------------------------------------------------
+# PNG decoding (8-bit greyscale, RGB, palette, grey+alpha and RGBA; no interlace)
+# ---------------------------------------------------------------------------
+
+def _paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def read_png(path):
+    """Returns (width, height, [(r, g, b, a), ...])."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path}: not a PNG file")
+
+    pos, idat, plte, trns = 8, b"", None, None
+    while pos + 8 <= len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            plte = chunk
+        elif kind == b"tRNS":
+            trns = chunk
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color_type)
+    if channels is None or interlace or (depth != 8 and color_type != 3):
+        raise ValueError(f"{path}: unsupported PNG (type {color_type}, depth {depth}, interlace {interlace})")
+
+    bits_per_pixel = channels * depth
+    bpp = max(1, bits_per_pixel // 8)
+    stride = (width * bits_per_pixel + 7) // 8
+    raw = zlib.decompress(idat)
+
+    rows, prev, i = [], bytearray(stride), 0
+    for _ in range(height):
+        filt = raw[i]
+        line = bytearray(raw[i + 1:i + 1 + stride])
+        i += 1 + stride
+        for x in range(stride):
+            a = line[x - bpp] if x >= bpp else 0
+            b = prev[x]
+            c = prev[x - bpp] if x >= bpp else 0
+            if filt == 1:
+                line[x] = (line[x] + a) & 0xFF
+            elif filt == 2:
+                line[x] = (line[x] + b) & 0xFF
+            elif filt == 3:
+                line[x] = (line[x] + (a + b) // 2) & 0xFF
+            elif filt == 4:
+                line[x] = (line[x] + _paeth(a, b, c)) & 0xFF
+        rows.append(line)
+        prev = line
+
+    pixels = []
+    for line in rows:
+        for x in range(width):
+            if color_type == 3:
+                bit = x * depth
+                index = (line[bit // 8] >> (8 - depth - bit % 8)) & ((1 << depth) - 1)
+                r, g, b = plte[index * 3:index * 3 + 3]
+                a = trns[index] if trns and index < len(trns) else 255
+            else:
+                px = line[x * channels:(x + 1) * channels]
+                if color_type == 0:
+                    r = g = b = px[0]; a = 255
+                elif color_type == 4:
+                    r = g = b = px[0]; a = px[1]
+                elif color_type == 2:
+                    r, g, b = px; a = 255
+                else:
+                    r, g, b, a = px
+            pixels.append((r, g, b, a))
+    return width, height, pixels
+
+
+def to_rgb565(pixels):
+    """Transparent pixels become black, the colour the UI draws as transparent."""
+    out = []
+    for r, g, b, a in pixels:
+        if a < 128:
+            out.append(0x0000)
+        else:
+            out.append(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+    return out
+
+
+# ---------------------------------------------------------------------------
+# Encoders
+# ---------------------------------------------------------------------------
+
+def build_palette(pixels):
+    """Colours by first appearance, with black first so it is always index 0."""
+    palette = [0x0000] if 0x0000 in pixels else []
+    for p in pixels:
+        if p not in palette:
+            palette.append(p)
+    return palette
+
+
+def encode_raw(pixels):
+    return None, 0, b"".join(struct.pack("<H", p) for p in pixels)
+
+
+def encode_palette(pixels, palette):
+    if len(palette) > 256:
+        return None
+    bits = next(b for b in (1, 2, 4, 8) if len(palette) <= (1 << b))
+    lookup = {c: i for i, c in enumerate(palette)}
+    out = bytearray((len(pixels) * bits + 7) // 8)
+    for n, p in enumerate(pixels):
+        bit = n * bits
+        out[bit // 8] |= lookup[p] << (8 - bits - bit % 8)
+    return palette, bits, bytes(out)
+
+
+def encode_rle(pixels, palette):
+    if len(palette) > 128:
+        return None
+    bits = max(1, (len(palette) - 1).bit_length())
+    run_bits = 8 - bits
+    short_max = (1 << run_bits) - 1
+    long_max = (1 << run_bits) + 255
+    lookup = {c: i for i, c in enumerate(palette)}
+    out = bytearray()
+
+    def emit(index, length):
+        while length > 0:
+            n = min(length, long_max)
+            if n <= short_max:
+                out.append((index << run_bits) | n)
+            else:
+                out.append(index << run_bits)
+                out.append(n - (1 << run_bits))
+            length -= n
+
+    run_color, run_len = pixels[0], 0
+    for p in pixels:
+        if p == run_color:
+            run_len += 1
+        else:
+            emit(lookup[run_color], run_len)
+            run_color, run_len = p, 1
+    emit(lookup[run_color], run_len)
+    return palette, bits, bytes(out)
+
+
+def decode(encoding, palette, bits, data, count):
+    """Mirror of IconDecoder, used to verify every encoded asset."""
+    if encoding == "raw":
+        return [data[2 * i] | (data[2 * i + 1] << 8) for i in range(count)]
+    if encoding == "palette":
+        out = []
+        for n in range(count):
+            bit = n * bits
+            out.append(palette[(data[bit // 8] >> (8 - bits - bit % 8)) & ((1 << bits) - 1)])
+        return out
+    run_bits = 8 - bits
+    out, pos = [], 0
+    while len(out) < count:
+        b = data[pos]
+        pos += 1
+        length = b & ((1 << run_bits) - 1)
+        if length == 0:
+            length = (1 << run_bits) + data[pos]
+            pos += 1
+        out.extend([palette[b >> run_bits]] * length)
+    return out
+
+
+def encode(pixels, wanted):
+    palette = build_palette(pixels)
+    candidates = {
+        "raw": encode_raw(pixels),
+        "palette": encode_palette(pixels, palette),
+        "rle": encode_rle(pixels, palette),
+    }
+
+    def size(result):
+        pal, _, data = result
+        return len(data) + (len(pal) * 2 if pal else 0)
+
+    if wanted == "auto":
+        wanted = min((e for e in ENCODINGS if candidates[e]), key=lambda e: size(candidates[e]))
+    if not candidates[wanted]:
+        raise ValueError(f"{len(palette)} colours cannot be stored as {wanted}")
+
+    pal, bits, data = candidates[wanted]
+    if decode(wanted, pal, bits, data, len(pixels)) != pixels:
+        raise AssertionError(f"{wanted} round trip failed")
+    return wanted, pal, bits, data, size(candidates[wanted])
+
+
+# ---------------------------------------------------------------------------
+# Reference scan
+# ---------------------------------------------------------------------------
+
+def referenced_symbols(root, symbols, generated):
+    found = set()
+    pattern = re.compile(r"\b(" + "|".join(map(re.escape, symbols)) + r")\b")
+    for top in SCAN_DIRS:
+        for dirpath, _, files in os.walk(os.path.join(root, top)):
+            for name in files:
+                path = os.path.join(dirpath, name)
+                if not name.endswith(SCAN_EXTS) or os.path.abspath(path) in generated:
+                    continue
+                with open(path, errors="ignore") as f:
+                    found.update(pattern.findall(f.read()))
+    return found
+
+
+# ---------------------------------------------------------------------------
+# Output
+# ---------------------------------------------------------------------------
+
+def format_array(values, fmt, per_line):
+    return "\n".join("    " + ", ".join(fmt.format(v) for v in values[i:i + per_line]) + ","
+                     for i in range(0, len(values), per_line))
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return False
+    with open(path, "w") as f:
+        f.write(text)
+    return True
+
+
+def generate(root, report=False):
+    with open(os.path.join(root, MANIFEST)) as f:
+        manifest = json.load(f)
+
+    asset_dir = os.path.dirname(os.path.join(root, MANIFEST))
+    out_base = os.path.join(root, manifest["output"])
+    header_path, source_path = out_base + ".h", out_base + ".cpp"
+    header_name = os.path.basename(header_path)
+    default_encoding = manifest.get("encoding", "auto")
+
+    assets = manifest["assets"]
+    used = referenced_symbols(root, list(assets), {os.path.abspath(header_path), os.path.abspath(source_path)})
+
+    banner = f"/* Generated by scripts/build_assets.py from {MANIFEST.replace(os.sep, '/')}. Do not edit. */"
+    header = [
+        "/**",
+        f" * @file {header_name}",
+        " * @brief Packed UI icons.",
+        " */",
+        banner,
+        "#pragma once",
+        "",
+        '#include "UI/Icon.h"',
+        "",
+    ]
+    header += [f"#define {k:<11} {v}" for k, v in manifest.get("defines", {}).items()]
+    header.append("")
+
+    source = [banner, f'#include "images/{header_name}"', "#include <pgmspace.h>", ""]
+    definitions = []
+
+    palettes, blobs = {}, {}
+    rows, dropped = [], []
+    raw_total = packed_total = 0
+
+    for symbol, spec in assets.items():
+        if isinstance(spec, str):
+            spec = {"file": spec}
+        if symbol not in used:
+            dropped.append(symbol)
+            continue
+
+        width, height, rgba = read_png(os.path.join(asset_dir, spec["file"]))
+        pixels = to_rgb565(rgba)
+        encoding, palette, bits, data, size = encode(pixels, spec.get("encoding", default_encoding))
+
+        shared = []
+        palette_name = "nullptr"
+        colors = len(palette) if palette else 0
+        if palette:
+            key = tuple(palette)
+            if key not in palettes:
+                palettes[key] = f"palette{len(palettes)}"
+                source += [f"static const uint16_t {palettes[key]}[{len(palette)}] PROGMEM = {{",
+                           format_array(palette, "0x{:04X}", 8), "};", ""]
+            else:
+                size -= len(palette) * 2
+                shared.append("palette")
+            palette_name = palettes[key]
+
+        key = (encoding, bits, data)
+        if key not in blobs:
+            blobs[key] = f"{symbol}Data"
+            source += [f"static const uint8_t {blobs[key]}[{len(data)}] PROGMEM = {{",
+                       format_array(list(data), "0x{:02X}", 16), "};", ""]
+        else:
+            size -= len(data)
+            shared.append("pixels")
+
+        definitions.append(f"const PackedIcon {symbol} = {{ {width}, {height}, ICON_ENCODING_{encoding.upper()}, "
+                           f"{bits}, {palette_name}, {colors}, {blobs[key]} }};")
+        header.append(f"extern const PackedIcon {symbol}; ///< {width}x{height}, {encoding}, {size} bytes.")
+
+        raw = width * height * 2
+        raw_total += raw
+        packed_total += size
+        rows.append((symbol, spec["file"], f"{width}x{height}", encoding, raw, size, ", ".join(shared)))
+
+    header.append("")
+    source += definitions + [""]
+
+    changed = write_if_changed(header_path, "\n".join(header))
+    changed |= write_if_changed(source_path, "\n".join(source))
+
+    print(f"assets: {len(rows)} icons, {raw_total} -> {packed_total} bytes"
+          + (f", dropped unreferenced: {', '.join(dropped)}" if dropped else "")
+          + ("" if changed else " (unchanged)"))
+    if report:
+        print(f"  {'symbol':<16} {'file':<16} {'size':<8} {'encoding':<8} {'raw':>6} {'packed':>7}  shared")
+        for symbol, file, dims, encoding, raw, size, shared in rows:
+            print(f"  {symbol:<16} {file:<16} {dims:<8} {encoding:<8} {raw:>6} {size:>7}  {shared}")
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO's SCons environment
+except NameError:
+    env = None
+
+if env is not None:
+    generate(env.subst("$PROJECT_DIR"), report=True)
+elif __name__ == "__main__":
+    generate(os.getcwd(), report="--report" in sys.argv)
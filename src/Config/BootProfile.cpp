@@ -0,0 +1,110 @@
+/**
+ * @file BootProfile.cpp
+ * @brief Boot profiler implementation.
+ *
+ * Each timestamp has a single writer and is written before its event bit
+ * is set, so readers that saw the bit see the time.
+ */
+#include "Config/BootProfile.h"
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_timer.h>
+#include <freertos/event_groups.h>
+
+static_assert(BOOT_PHASE_COUNT <= 24, "boot phases must fit in an event group");
+
+/** @brief Phases that together make the device interactive. */
+static constexpr EventBits_t INTERACTIVE_BITS = (1UL << BOOT_PHASE_SETUP_DONE) |
+                                                (1UL << BOOT_PHASE_LOGO) |
+                                                (1UL << BOOT_PHASE_SETTINGS);
+
+static const char* const phaseNames[BOOT_PHASE_COUNT] = {
+    "config", "ui", "power", "savedata", "encoder", "motor",
+    "buzzer", "telemetry", "setup", "tft", "logo", "settings"
+};
+
+/** @brief Interactive times since power-up. Kept across deep sleep. */
+struct BootStats
+{
+    uint32_t boots;   ///< Boots measured.
+    uint32_t lastUs;  ///< Previous boot.
+    uint32_t bestUs;  ///< Fastest boot.
+    uint32_t worstUs; ///< Slowest boot.
+};
+
+RTC_DATA_ATTR static BootStats stats;
+
+static EventGroupHandle_t phaseBits = nullptr;
+static uint32_t           phaseUs[BOOT_PHASE_COUNT];
+
+static portMUX_TYPE markLock = portMUX_INITIALIZER_UNLOCKED;
+
+void BootProfile_init()
+{
+    phaseBits = xEventGroupCreate();
+    configASSERT(phaseBits);
+}
+
+void BootProfile_mark(BootPhase phase)
+{
+    if (phase >= BOOT_PHASE_COUNT)
+        return;
+
+    const EventBits_t bit = 1UL << phase;
+    const uint32_t    now = (uint32_t)esp_timer_get_time();
+
+    portENTER_CRITICAL(&markLock);
+    const bool first = (phaseUs[phase] == 0);
+    if (first)
+        phaseUs[phase] = now;
+    portEXIT_CRITICAL(&markLock);
+
+    if (first)
+        xEventGroupSetBits(phaseBits, bit);
+}
+
+uint32_t BootProfile_phaseUs(BootPhase phase)
+{
+    return (phase < BOOT_PHASE_COUNT) ? phaseUs[phase] : 0;
+}
+
+bool BootProfile_waitInteractive(TickType_t timeout)
+{
+    EventBits_t bits = xEventGroupWaitBits(phaseBits, INTERACTIVE_BITS, pdFALSE, pdTRUE, timeout);
+    return (bits & INTERACTIVE_BITS) == INTERACTIVE_BITS;
+}
+
+uint32_t BootProfile_interactiveUs()
+{
+    if ((xEventGroupGetBits(phaseBits) & INTERACTIVE_BITS) != INTERACTIVE_BITS)
+        return 0;
+
+    uint32_t latest = 0;
+    for (uint8_t i = 0; i < BOOT_PHASE_COUNT; i++)
+    {
+        if ((INTERACTIVE_BITS & (1UL << i)) && phaseUs[i] > latest)
+            latest = phaseUs[i];
+    }
+    return latest;
+}
+
+void BootProfile_report()
+{
+    const uint32_t interactiveUs = BootProfile_interactiveUs();
+    if (interactiveUs == 0)
+        return;
+
+    for (uint8_t i = 0; i < BOOT_PHASE_COUNT; i++)
+        log_i("Boot %-9s %7lu us", phaseNames[i], (unsigned long)phaseUs[i]);
+
+    if (stats.boots == 0 || interactiveUs < stats.bestUs)  stats.bestUs  = interactiveUs;
+    if (interactiveUs > stats.worstUs)                     stats.worstUs = interactiveUs;
+
+    log_i("Interactive after %lu ms (previous %lu, best %lu, worst %lu, %lu boots)",
+          (unsigned long)(interactiveUs / 1000), (unsigned long)(stats.lastUs / 1000),
+          (unsigned long)(stats.bestUs / 1000), (unsigned long)(stats.worstUs / 1000),
+          (unsigned long)(stats.boots + 1));
+
+    stats.lastUs = interactiveUs;
+    stats.boots++;
+}
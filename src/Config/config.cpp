@@ -3,34 +3,38 @@
  * @brief Global system queue initialization.
  */
 #include "Config/config.h"
+#include "Input/InputRing.h"
+#include <atomic>
 
 /* =========================
    QUEUE DEFINITIONS
    ========================= */
 
-QueueHandle_t xUIQueue       = nullptr;
 QueueHandle_t xMotorQueue    = nullptr;
 QueueHandle_t xPowerQueue    = nullptr;
 QueueHandle_t xSettingsQueue = nullptr;
 QueueHandle_t xBuzzerQueue   = nullptr;
 
+/** @brief Buzzer commands lost to a full queue. */
+static std::atomic<uint32_t> buzzerDroppedCount{0};
+
 /* =========================
    INITIALIZATION
    ========================= */
 
 /**
- * @brief Creates all FreeRTOS queues used by the system.
+ * @brief Creates all FreeRTOS queues used by the system and resets the input ring.
  */
 void Config_init()
 {
-   xUIQueue       = xQueueCreate(10, sizeof(EncoderEvent)); configASSERT(xUIQueue);
+   InputRing_init();
    xMotorQueue    = xQueueCreate(4, sizeof(MotorCommand)); configASSERT(xMotorQueue);
    xPowerQueue    = xQueueCreate(2, sizeof(PowerCommand)); configASSERT(xPowerQueue);
    xSettingsQueue = xQueueCreate(2, sizeof(SettingsCommand)); configASSERT(xSettingsQueue);
    xBuzzerQueue   = xQueueCreate(4, sizeof(BuzzerCommand)); configASSERT(xBuzzerQueue);
 }
 
-void sendMotorRequest(MotorCmdType type, int speed, uint32_t duration)
+void sendMotorRequest(MotorCmdType type, int speed, uint32_t duration, uint8_t channel)
 {
     if (speed < 0)   speed = 0;
     if (speed > 100) speed = 100;
@@ -38,12 +42,47 @@ void sendMotorRequest(MotorCmdType type, int speed, uint32_t duration)
     MotorCommand cmd = {
         .type     = type,
         .speed    = (uint8_t)speed,
-        .duration = duration
+        .duration = duration,
+        .rampMs   = 0,
+        .flags    = 0,
+        .channel  = channel
+    };
+
+    configASSERT(xQueueSend(xMotorQueue, &cmd, 0) == pdPASS);
+}
+
+void sendPurgeRequest(int speed, uint32_t duration, uint16_t rampMs, bool stopWhenPrimed,
+                      uint8_t channel)
+{
+    if (speed < 0)   speed = 0;
+    if (speed > 100) speed = 100;
+
+    MotorCommand cmd = {
+        .type     = MOTOR_CMD_CLEAN_PURGE,
+        .speed    = (uint8_t)speed,
+        .duration = duration,
+        .rampMs   = rampMs,
+        .flags    = (uint8_t)(stopWhenPrimed ? MOTOR_FLAG_STOP_WHEN_PRIMED : 0),
+        .channel  = channel
     };
 
     configASSERT(xQueueSend(xMotorQueue, &cmd, 0) == pdPASS);
 }
 
+bool sendMotorShutdown(uint32_t waitMs)
+{
+    MotorCommand cmd = {
+        .type     = MOTOR_CMD_SHUTDOWN,
+        .speed    = 0,
+        .duration = 0,
+        .rampMs   = 0,
+        .flags    = 0,
+        .channel  = MOTOR_CHANNEL_ALL
+    };
+
+    return xQueueSendToFront(xMotorQueue, &cmd, pdMS_TO_TICKS(waitMs)) == pdPASS;
+}
+
 void sendPowerRequest(PowerCmdType type)
 {
     PowerCommand cmd = {};
@@ -63,9 +102,18 @@ void sendSettingsSave(SettingsCmdType type, int motorSpeed, uint8_t timeIndex)
     configASSERT(xQueueSend(xSettingsQueue, &cmd, 0) == pdPASS);
 }
 
-void sendBuzzerCommand(BuzzerCmdType type)
+bool sendBuzzerCommand(BuzzerCmdType type)
 {
     BuzzerCommand cmd = {};
     cmd.type = type;
-    configASSERT(xQueueSend(xBuzzerQueue, &cmd, 0) == pdPASS);
+    if (xQueueSend(xBuzzerQueue, &cmd, 0) == pdPASS)
+        return true;
+
+    buzzerDroppedCount.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+uint32_t buzzerCommandsDropped()
+{
+    return buzzerDroppedCount.load(std::memory_order_relaxed);
 }
\ No newline at end of file
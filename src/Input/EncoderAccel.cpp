@@ -0,0 +1,126 @@
+/**
+ * @file EncoderAccel.cpp
+ * @brief Velocity-based encoder acceleration implementation.
+ *
+ * Gains are Q8 fixed point (256 = one unit per detent). The fractional part
+ * of each move is carried to the next event so mid-curve speeds do not
+ * round to the same integer step.
+ */
+#include "Input/EncoderAccel.h"
+
+void EncoderAccel_reset(EncoderAccel* accel)
+{
+    accel->first      = 0;
+    accel->count      = 0;
+    accel->dir        = 0;
+    accel->residualQ8 = 0;
+}
+
+/**
+ * @brief Detents per second over the held window, including `detents` arriving at `nowMs`.
+ *
+ * The oldest event only marks the start of the window; its own detents
+ * happened before it. Returns 0 when there is no earlier event to measure
+ * against.
+ */
+static uint32_t velocityDps(const EncoderAccel* accel, uint16_t detents, uint32_t nowMs)
+{
+    if (accel->count == 0)
+        return 0;
+
+    uint32_t total = detents;
+    for (uint8_t i = 1; i < accel->count; i++)
+        total += accel->detents[(accel->first + i) % ACCEL_HISTORY];
+
+    uint32_t spanMs = nowMs - accel->stampMs[accel->first];
+    if (spanMs == 0) spanMs = 1;
+
+    return total * 1000 / spanMs;
+}
+
+/**
+ * @brief Maps a velocity to a Q8 gain between 1 and `maxStep`.
+ */
+static uint32_t curveGainQ8(const EncoderAccelCurve& curve, uint32_t dps, uint32_t maxStep)
+{
+    if (dps <= curve.slowDps || maxStep <= 1)
+        return 256;
+
+    if (dps >= curve.fastDps)
+        return maxStep * 256;
+
+    /* Quadratic ease-in: t in 0…256 over slowDps…fastDps. */
+    uint32_t t  = (dps - curve.slowDps) * 256 / (curve.fastDps - curve.slowDps);
+    uint32_t t2 = t * t / 256;
+
+    return 256 + (maxStep - 1) * t2;
+}
+
+int32_t EncoderAccel_apply(EncoderAccel* accel, const EncoderAccelCurve& curve,
+                           int16_t delta, uint32_t timestampMs,
+                           int32_t value, int32_t minValue, int32_t maxValue,
+                           bool* saturated)
+{
+    if (saturated) *saturated = false;
+    if (delta == 0) return value;
+
+    int8_t   dir     = (delta > 0) ? 1 : -1;
+    uint16_t detents = (uint16_t)(delta * dir);
+
+    /* A reversal is a deliberate correction: start measuring afresh. */
+    if (dir != accel->dir)
+    {
+        EncoderAccel_reset(accel);
+        accel->dir = dir;
+    }
+
+    while (accel->count > 0 && timestampMs - accel->stampMs[accel->first] > curve.windowMs)
+    {
+        accel->first = (accel->first + 1) % ACCEL_HISTORY;
+        accel->count--;
+    }
+
+    uint32_t dps = velocityDps(accel, detents, timestampMs);
+
+    if (accel->count == ACCEL_HISTORY)
+    {
+        accel->first = (accel->first + 1) % ACCEL_HISTORY;
+        accel->count--;
+    }
+    uint8_t slot = (accel->first + accel->count) % ACCEL_HISTORY;
+    accel->stampMs[slot] = timestampMs;
+    accel->detents[slot] = detents;
+    accel->count++;
+
+    uint32_t range   = (uint32_t)(maxValue - minValue);
+    uint32_t maxStep = range * curve.maxStepPct / 100;
+    if (maxStep < 1) maxStep = 1;
+
+    uint32_t gainQ8 = curveGainQ8(curve, dps, maxStep);
+
+    /* Decelerate towards the bound the knob is heading for. */
+    int32_t distance = (dir > 0) ? maxValue - value : value - minValue;
+    if (distance < 0) distance = 0;
+    uint32_t edgeCapQ8 = 256 + (uint32_t)distance * 256 / (curve.edgeDivisor ? curve.edgeDivisor : 1);
+    if (gainQ8 > edgeCapQ8) gainQ8 = edgeCapQ8;
+
+    if (gainQ8 == 256)
+        accel->residualQ8 = 0;
+
+    uint32_t moveQ8   = detents * gainQ8 + accel->residualQ8;
+    accel->residualQ8 = (uint8_t)(moveQ8 & 0xFF);
+
+    int32_t target = value + dir * (int32_t)(moveQ8 >> 8);
+
+    if (target > maxValue)
+    {
+        if (saturated) *saturated = true;
+        return maxValue;
+    }
+    if (target < minValue)
+    {
+        if (saturated) *saturated = true;
+        return minValue;
+    }
+    return target;
+}
@@ -0,0 +1,190 @@
+/**
+ * @file Gesture.cpp
+ * @brief Gesture recogniser implementation.
+ *
+ * All comparisons use `now - start >= span`, which stays correct across
+ * the 49-day wrap of the millisecond clock.
+ */
+#include "Input/Gesture.h"
+
+static InputEvent makeEvent(InputEventType type, int16_t delta, uint32_t timestampMs, uint32_t pressMs)
+{
+    InputEvent evt = {
+        .type        = type,
+        .delta       = delta,
+        .timestampMs = timestampMs,
+        .pressMs     = pressMs
+    };
+    return evt;
+}
+
+/**
+ * @brief Reports the click waiting for a possible second press.
+ */
+static uint8_t flushPendingClick(Gesture* g, InputEvent* out)
+{
+    out[0]   = makeEvent(BTN_SHORT, 0, g->releaseMs, g->releaseMs - g->pressMs);
+    g->state = GESTURE_IDLE;
+    return 1;
+}
+
+/**
+ * @brief Gives up on a double click: reports the first click and carries
+ *        on with the second press as an ordinary press.
+ */
+static uint8_t splitDoubleClick(Gesture* g, InputEvent* out)
+{
+    uint8_t n  = flushPendingClick(g, out);
+    g->pressMs = g->secondPressMs;
+    g->state   = GESTURE_PRESSED;
+    return n;
+}
+
+void Gesture_init(Gesture* g, const GestureConfig& config)
+{
+    g->config        = config;
+    g->state         = GESTURE_IDLE;
+    g->pressMs       = 0;
+    g->releaseMs     = 0;
+    g->secondPressMs = 0;
+    g->nextRepeatMs  = 0;
+}
+
+uint8_t Gesture_button(Gesture* g, bool pressed, uint32_t nowMs, InputEvent* out)
+{
+    uint8_t n = 0;
+
+    if (pressed)
+    {
+        /* A press arriving after the window was missed by the tick still ends the old click. */
+        if (g->state == GESTURE_CLICK_PENDING && nowMs - g->releaseMs > g->config.doubleClickMs)
+            n = flushPendingClick(g, out);
+
+        switch (g->state)
+        {
+            case GESTURE_IDLE:
+                g->state   = GESTURE_PRESSED;
+                g->pressMs = nowMs;
+                break;
+            case GESTURE_CLICK_PENDING:
+                g->state         = GESTURE_SECOND_PRESSED;
+                g->secondPressMs = nowMs;
+                break;
+            default:
+                break;
+        }
+        return n;
+    }
+
+    switch (g->state)
+    {
+        case GESTURE_PRESSED:
+            g->releaseMs = nowMs;
+            if (g->config.doubleClickMs == 0)
+                return flushPendingClick(g, out);
+            g->state = GESTURE_CLICK_PENDING;
+            break;
+        case GESTURE_SECOND_PRESSED:
+            out[n++] = makeEvent(BTN_DOUBLE, 0, nowMs, nowMs - g->pressMs);
+            g->state = GESTURE_IDLE;
+            break;
+        case GESTURE_HELD:
+        case GESTURE_ROTATED:
+            g->state = GESTURE_IDLE;
+            break;
+        default:
+            break;
+    }
+    return n;
+}
+
+uint8_t Gesture_rotate(Gesture* g, int16_t delta, uint32_t nowMs, InputEvent* out)
+{
+    uint8_t n = 0;
+
+    if (delta == 0)
+        return 0;
+
+    switch (g->state)
+    {
+        case GESTURE_CLICK_PENDING:
+            n = flushPendingClick(g, out);
+            /* fall through */
+        case GESTURE_IDLE:
+            out[n++] = makeEvent(ENC_ROTATE, delta, nowMs, 0);
+            break;
+        case GESTURE_SECOND_PRESSED:
+            /* The first click stands on its own; the second press becomes a press-rotate. */
+            n = splitDoubleClick(g, out);
+            /* fall through */
+        default:
+            g->state = GESTURE_ROTATED;
+            out[n++] = makeEvent(ENC_PRESS_ROTATE, delta, nowMs, 0);
+            break;
+    }
+    return n;
+}
+
+uint8_t Gesture_tick(Gesture* g, uint32_t nowMs, InputEvent* out)
+{
+    const GestureConfig& cfg = g->config;
+    uint8_t n = 0;
+
+    switch (g->state)
+    {
+        case GESTURE_CLICK_PENDING:
+            if (nowMs - g->releaseMs >= cfg.doubleClickMs)
+                n = flushPendingClick(g, out);
+            break;
+        case GESTURE_SECOND_PRESSED:
+            if (nowMs - g->secondPressMs < cfg.longPressMs)
+                break;
+            n = splitDoubleClick(g, out);
+            /* fall through */
+        case GESTURE_PRESSED:
+            if (nowMs - g->pressMs >= cfg.longPressMs)
+            {
+                out[n++]        = makeEvent(BTN_LONG, 0, nowMs, nowMs - g->pressMs);
+                g->state        = GESTURE_HELD;
+                g->nextRepeatMs = g->pressMs + cfg.longPressMs + cfg.repeatDelayMs;
+            }
+            break;
+        case GESTURE_HELD:
+            if (cfg.repeatPeriodMs != 0 && (int32_t)(nowMs - g->nextRepeatMs) >= 0)
+            {
+                out[n++]         = makeEvent(BTN_REPEAT, 0, nowMs, nowMs - g->pressMs);
+                g->nextRepeatMs += cfg.repeatPeriodMs;
+            }
+            break;
+        default:
+            break;
+    }
+    return n;
+}
+
+uint32_t Gesture_msUntilDeadline(const Gesture* g, uint32_t nowMs)
+{
+    const GestureConfig& cfg = g->config;
+    uint32_t elapsed;
+
+    switch (g->state)
+    {
+        case GESTURE_CLICK_PENDING:
+            elapsed = nowMs - g->releaseMs;
+            return (elapsed >= cfg.doubleClickMs) ? 0 : cfg.doubleClickMs - elapsed;
+        case GESTURE_SECOND_PRESSED:
+            elapsed = nowMs - g->secondPressMs;
+            return (elapsed >= cfg.longPressMs) ? 0 : cfg.longPressMs - elapsed;
+        case GESTURE_PRESSED:
+            elapsed = nowMs - g->pressMs;
+            return (elapsed >= cfg.longPressMs) ? 0 : cfg.longPressMs - elapsed;
+        case GESTURE_HELD:
+            if (cfg.repeatPeriodMs == 0)
+                return UINT32_MAX;
+            if ((int32_t)(nowMs - g->nextRepeatMs) >= 0)
+                return 0;
+            return g->nextRepeatMs - nowMs;
+        default:
+            return UINT32_MAX;
+    }
+}
@@ -0,0 +1,173 @@
+/**
+ * @file InputRing.cpp
+ * @brief Lock-free input event buffer implementation.
+ *
+ * The producer publishes `head` (release) and the consumer publishes
+ * `tail` (release), as in MotorTelemetry. Merging a rotation touches a slot
+ * the consumer may be reading at the same moment, so the rotation state of
+ * every slot lives in one atomic word:
+ * - bits 16–31: net delta (int16);
+ * - bits 0–15:  low 16 bits of the timestamp of the last merged detent.
+ *
+ * ENC_ROTATE and ENC_PRESS_ROTATE are both rotations; only events of the
+ * same type are merged. The consumer claims a rotation by swapping
+ * ROTATION_CLAIMED into the word before reading it; the producer merges
+ * with a compare-and-swap that fails once the slot is claimed, and then
+ * pushes a new slot instead.
+ * Button slots and free slots always hold ROTATION_CLAIMED.
+ *
+ * The full timestamp is rebuilt from `millis()` at pop time, which is exact
+ * as long as an event is consumed within 65 s.
+ */
+#include "Input/InputRing.h"
+#include <Arduino.h>
+#include <atomic>
+
+/** @brief Rotation word of a slot that can no longer be merged into. */
+static constexpr uint32_t ROTATION_CLAIMED = 0x80000000UL;
+
+/** @brief One buffered event. */
+struct InputSlot
+{
+    InputEventType        type;        ///< Event type.
+    uint32_t              timestampMs; ///< Button edge time (BTN_* only).
+    uint32_t              pressMs;     ///< Hold time (BTN_* only).
+    std::atomic<uint32_t> rotation;    ///< Packed delta/timestamp (rotations only).
+};
+
+static InputSlot ring[INPUT_RING_CAPACITY];
+
+static std::atomic<uint32_t> head{0};
+static std::atomic<uint32_t> tail{0};
+static std::atomic<uint32_t> droppedCount{0};
+
+static std::atomic<TaskHandle_t> consumerTask{nullptr};
+
+static uint32_t packRotation(int16_t delta, uint32_t timestampMs)
+{
+    return ((uint32_t)(uint16_t)delta << 16) | (timestampMs & 0xFFFF);
+}
+
+static int16_t rotationDelta(uint32_t word)
+{
+    return (int16_t)(uint16_t)(word >> 16);
+}
+
+static bool isRotation(InputEventType type)
+{
+    return type == ENC_ROTATE || type == ENC_PRESS_ROTATE;
+}
+
+/**
+ * @brief Tries to add a rotation to the newest slot if it is an unread
+ *        rotation of the same type.
+ *
+ * `type` of the newest slot was written by the producer itself, so reading
+ * it here needs no synchronisation.
+ */
+static bool mergeRotation(uint32_t h, const InputEvent& evt)
+{
+    InputSlot& slot = ring[(h - 1) & (INPUT_RING_CAPACITY - 1)];
+    if (slot.type != evt.type)
+        return false;
+
+    std::atomic<uint32_t>& word = slot.rotation;
+    uint32_t current = word.load(std::memory_order_relaxed);
+    int16_t  delta   = evt.delta;
+
+    while (current != ROTATION_CLAIMED)
+    {
+        int32_t sum = (int32_t)rotationDelta(current) + delta;
+        if (sum > INT16_MAX || sum < -INT16_MAX)
+            return false;
+
+        if (word.compare_exchange_weak(current, packRotation((int16_t)sum, evt.timestampMs),
+                                       std::memory_order_release, std::memory_order_relaxed))
+            return true;
+    }
+
+    return false;
+}
+
+void InputRing_init()
+{
+    for (uint32_t i = 0; i < INPUT_RING_CAPACITY; i++)
+        ring[i].rotation.store(ROTATION_CLAIMED, std::memory_order_relaxed);
+
+    head.store(0, std::memory_order_relaxed);
+    tail.store(0, std::memory_order_relaxed);
+    droppedCount.store(0, std::memory_order_relaxed);
+}
+
+void InputRing_setConsumer(TaskHandle_t task)
+{
+    consumerTask.store(task, std::memory_order_release);
+}
+
+bool InputRing_push(const InputEvent& evt)
+{
+    uint32_t h = head.load(std::memory_order_relaxed);
+
+    if (isRotation(evt.type) && mergeRotation(h, evt))
+    {
+        TaskHandle_t task = consumerTask.load(std::memory_order_acquire);
+        if (task) xTaskNotifyGive(task);
+        return true;
+    }
+
+    uint32_t limit = isRotation(evt.type)
+                   ? INPUT_RING_CAPACITY - INPUT_RING_BUTTON_RESERVE
+                   : INPUT_RING_CAPACITY;
+
+    if (h - tail.load(std::memory_order_acquire) >= limit)
+    {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    InputSlot& slot  = ring[h & (INPUT_RING_CAPACITY - 1)];
+    slot.type        = evt.type;
+    slot.timestampMs = evt.timestampMs;
+    slot.pressMs     = evt.pressMs;
+    slot.rotation.store(isRotation(evt.type) ? packRotation(evt.delta, evt.timestampMs)
+                                               : ROTATION_CLAIMED,
+                        std::memory_order_relaxed);
+
+    head.store(h + 1, std::memory_order_release);
+
+    TaskHandle_t task = consumerTask.load(std::memory_order_acquire);
+    if (task) xTaskNotifyGive(task);
+    return true;
+}
+
+bool InputRing_pop(InputEvent* out)
+{
+    uint32_t t = tail.load(std::memory_order_relaxed);
+
+    if (t == head.load(std::memory_order_acquire))
+        return false;
+
+    InputSlot& slot  = ring[t & (INPUT_RING_CAPACITY - 1)];
+    out->type        = slot.type;
+    out->delta       = 0;
+    out->timestampMs = slot.timestampMs;
+    out->pressMs     = slot.pressMs;
+
+    if (isRotation(slot.type))
+    {
+        uint32_t word = slot.rotation.exchange(ROTATION_CLAIMED, std::memory_order_acquire);
+        uint32_t now  = millis();
+
+        out->delta       = rotationDelta(word);
+        out->timestampMs = now - (uint16_t)((uint16_t)now - (uint16_t)word);
+        out->pressMs     = 0;
+    }
+
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+}
+
+uint32_t InputRing_dropped()
+{
+    return droppedCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,450 @@
+/**
+ * @file MotorCalibration.cpp
+ * @brief Speed curve storage and characterisation sweep implementation.
+ */
+#include "Motor/MotorCalibration.h"
+#include "Tasks/TaskMotor.h"
+#include "Config/pins.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <esp_attr.h>
+
+/** @brief Layout version of a stored MotorCurve. 0 marks the reference curve. */
+static constexpr uint8_t CAL_CURVE_VERSION = 1;
+
+/** @brief Minimum duty of the reference curve, in percent of MAX_DUTY. */
+static constexpr uint32_t REF_MIN_DUTY_PCT = 20;
+
+static Preferences prefs;
+
+/** @brief Sweep phases. */
+enum CalPhase {
+    CAL_PHASE_IDLE,          ///< No sweep running.
+    CAL_PHASE_BASELINE,      ///< Motor off, learning the idle feedback.
+    CAL_PHASE_SETTLING,      ///< Waiting for the pump to settle at the new duty.
+    CAL_PHASE_SAMPLING,      ///< Averaging feedback at the current duty.
+    CAL_PHASE_DRIP_SETTLING, ///< Drip bursts running, waiting for the pattern to settle.
+    CAL_PHASE_DRIP_SAMPLING  ///< Counting drops against bursts at the current rate.
+};
+
+/** @brief Sweep state of one pump channel. */
+struct SweepState {
+    CalPhase phase;
+    uint8_t  step;                          ///< Current duty step (1 … CAL_SWEEP_STEPS).
+    uint32_t phaseStartMs;
+    uint32_t sampleSum;
+    uint32_t sampleN;
+    uint32_t dropsAtStart;                  ///< Drop counter at the start of the window.
+    uint8_t  dripStep;                      ///< Current burst rate step (1 … CAL_DRIP_STEPS).
+    uint8_t  dripRange;                     ///< Measured drip range; 0 when not measured.
+    uint32_t feedback[CAL_SWEEP_STEPS + 1]; ///< [0] idle baseline, [k] feedback at step k.
+};
+
+static MotorCurve curves[MOTOR_CHANNEL_COUNT];
+static bool       calibrated[MOTOR_CHANNEL_COUNT] = {};
+static SweepState sweeps[MOTOR_CHANNEL_COUNT]     = {};
+
+static volatile uint32_t dropCount[MOTOR_CHANNEL_COUNT] = {};
+
+static void IRAM_ATTR dropIsr(void* arg)
+{
+    dropCount[(uintptr_t)arg] = dropCount[(uintptr_t)arg] + 1;
+}
+
+/**
+ * @brief Reference quadratic curve used until a pump is characterised.
+ */
+static uint32_t referenceDuty(uint8_t percent)
+{
+    if (percent == 0)
+        return 0;
+
+    const float minDuty = REF_MIN_DUTY_PCT / 100.0f;
+
+    float x = percent / 100.0f;
+    float y = minDuty + (1.0f - minDuty) * x * x;
+
+    return (uint32_t)(y * MAX_DUTY);
+}
+
+/** @brief LEDC duty applied at sweep step `step`. */
+static uint16_t dutyAt(uint8_t step)
+{
+    return (uint16_t)(step * MAX_DUTY / CAL_SWEEP_STEPS);
+}
+
+static bool usesCurrent(uint8_t channel)
+{
+    return PIN_MOTOR_CURRENT[channel] >= 0;
+}
+
+static bool hasDropSensor(uint8_t channel)
+{
+    return PIN_DROP_SENSOR[channel] >= 0;
+}
+
+/** @brief Drip speed tried at drip sweep step `step`. */
+static uint8_t dripSpeedAt(uint8_t step)
+{
+    return (uint8_t)(step * 100 / CAL_DRIP_STEPS);
+}
+
+/** @brief Burst period at drip sweep step `step`. */
+static uint32_t dripPeriodAt(uint8_t step)
+{
+    return CAL_DRIP_PERIOD_MS / dripSpeedAt(step);
+}
+
+static void keyFor(uint8_t channel, char* key)
+{
+    snprintf(key, 8, "ch%u", channel);
+}
+
+void MotorCal_init()
+{
+    prefs.begin("motorcal", true);
+
+    for (uint8_t ch = 0; ch < MOTOR_CHANNEL_COUNT; ch++)
+    {
+        char key[8];
+        keyFor(ch, key);
+
+        MotorCurve stored;
+        calibrated[ch] = prefs.getBytesLength(key) == sizeof(MotorCurve) &&
+                         prefs.getBytes(key, &stored, sizeof(stored)) == sizeof(MotorCurve) &&
+                         stored.version == CAL_CURVE_VERSION;
+        if (calibrated[ch])
+            curves[ch] = stored;
+
+        if (PIN_DROP_SENSOR[ch] >= 0)
+        {
+            pinMode(PIN_DROP_SENSOR[ch], INPUT_PULLUP);
+            attachInterruptArg(PIN_DROP_SENSOR[ch], dropIsr, (void*)(uintptr_t)ch, FALLING);
+        }
+    }
+
+    prefs.end();
+}
+
+bool MotorCal_available(uint8_t channel)
+{
+    if (channel >= MOTOR_CHANNEL_COUNT) return false;
+
+    return usesCurrent(channel) || hasDropSensor(channel);
+}
+
+bool MotorCal_isCalibrated(uint8_t channel)
+{
+    return channel < MOTOR_CHANNEL_COUNT && calibrated[channel];
+}
+
+uint32_t MotorCal_speedToDuty(uint8_t channel, uint8_t percent)
+{
+    if (percent > 100)
+        percent = 100;
+
+    if (!MotorCal_isCalibrated(channel))
+        return referenceDuty(percent);
+
+    if (percent == 0)
+        return 0;
+
+    const uint16_t* p = curves[channel].points;
+
+    uint32_t pos  = percent * (CAL_CURVE_POINTS - 1);
+    uint32_t idx  = pos / 100;
+    uint32_t frac = pos % 100;
+
+    if (idx >= CAL_CURVE_POINTS - 1)
+        return p[CAL_CURVE_POINTS - 1];
+
+    return p[idx] + (uint32_t)(p[idx + 1] - p[idx]) * frac / 100;
+}
+
+uint8_t MotorCal_dripRange(uint8_t channel)
+{
+    return MotorCal_isCalibrated(channel) ? curves[channel].dripRange : CAL_DRIP_RANGE_DEFAULT;
+}
+
+void MotorCal_getCurve(uint8_t channel, MotorCurve* out)
+{
+    if (MotorCal_isCalibrated(channel))
+    {
+        *out = curves[channel];
+        return;
+    }
+
+    *out = {};
+    out->dripRange = CAL_DRIP_RANGE_DEFAULT;
+    out->startDuty = (uint16_t)referenceDuty(1);
+    out->fullDuty  = (uint16_t)MAX_DUTY;
+    for (uint8_t i = 0; i < CAL_CURVE_POINTS; i++)
+        out->points[i] = (uint16_t)referenceDuty(i * 10);
+}
+
+uint32_t MotorCal_durationMs(uint8_t channel)
+{
+    uint32_t windowMs = usesCurrent(channel) ? CAL_CURRENT_WINDOW_MS : CAL_DROP_WINDOW_MS;
+    uint32_t dripMs   = hasDropSensor(channel) ? CAL_DRIP_STEPS * (CAL_DRIP_SETTLE_MS + CAL_DRIP_WINDOW_MS) : 0;
+    return CAL_BASELINE_MS + CAL_SWEEP_STEPS * (CAL_SETTLE_MS + windowMs) + dripMs;
+}
+
+/** @brief Restarts feedback accumulation for a new window. */
+static void openWindow(uint8_t channel, uint32_t nowMs)
+{
+    SweepState& sw = sweeps[channel];
+    sw.phaseStartMs = nowMs;
+    sw.sampleSum    = 0;
+    sw.sampleN      = 0;
+    sw.dropsAtStart = dropCount[channel];
+}
+
+/** @brief Returns the feedback accumulated since openWindow(). */
+static uint32_t windowValue(uint8_t channel)
+{
+    const SweepState& sw = sweeps[channel];
+
+    if (usesCurrent(channel))
+        return sw.sampleN ? sw.sampleSum / sw.sampleN : 0;
+
+    return dropCount[channel] - sw.dropsAtStart;
+}
+
+/**
+ * @brief Derives and stores the speed curve from the sweep feedback.
+ *
+ * @return False when no start threshold or usable range was found.
+ */
+static bool buildCurve(uint8_t channel)
+{
+    SweepState& sw = sweeps[channel];
+    uint32_t*   fb = sw.feedback;
+
+    uint32_t threshold;
+    if (usesCurrent(channel))
+    {
+        uint32_t delta = fb[0] * CAL_START_DELTA_PCT / 100;
+        threshold = fb[0] + (delta > CAL_START_DELTA_MIN_MV ? delta : CAL_START_DELTA_MIN_MV);
+    }
+    else
+    {
+        // Idle drops (e.g. siphoning) scaled from the baseline window to a step window.
+        threshold = fb[0] * CAL_DROP_WINDOW_MS / CAL_BASELINE_MS + 1;
+    }
+
+    uint8_t startIdx = 0;
+    for (uint8_t k = 1; k <= CAL_SWEEP_STEPS && startIdx == 0; k++)
+        if (fb[k] >= threshold)
+            startIdx = k;
+
+    if (startIdx == 0)
+        return false;
+
+    // Noise must not fold the curve back: make feedback monotonic from the start step.
+    for (uint8_t k = startIdx + 1; k <= CAL_SWEEP_STEPS; k++)
+        if (fb[k] < fb[k - 1])
+            fb[k] = fb[k - 1];
+
+    uint32_t fbStart = fb[startIdx];
+    uint32_t fbTop   = fb[CAL_SWEEP_STEPS];
+
+    if (fbTop <= fbStart)
+        return false;
+
+    uint32_t fullTarget = fbStart + (fbTop - fbStart) * CAL_FULL_PCT / 100;
+    uint8_t  fullIdx    = startIdx;
+    while (fullIdx < CAL_SWEEP_STEPS && fb[fullIdx] < fullTarget)
+        fullIdx++;
+
+    if (fullIdx <= startIdx)
+        return false;
+
+    MotorCurve curve = {};
+    curve.version   = CAL_CURVE_VERSION;
+    curve.startDuty = dutyAt(startIdx);
+    curve.fullDuty  = dutyAt(fullIdx);
+
+    uint32_t fbFull = fb[fullIdx];
+    uint8_t  k      = startIdx;
+
+    for (uint8_t i = 0; i < CAL_CURVE_POINTS; i++)
+    {
+        uint32_t target = fbStart + (fbFull - fbStart) * i / (CAL_CURVE_POINTS - 1);
+
+        while (k < fullIdx && fb[k] < target)
+            k++;
+
+        if (k == startIdx || fb[k] == fb[k - 1])
+        {
+            curve.points[i] = dutyAt(k);
+        }
+        else
+        {
+            uint32_t lo = dutyAt(k - 1);
+            uint32_t hi = dutyAt(k);
+            curve.points[i] = (uint16_t)(lo + (hi - lo) * (target - fb[k - 1]) / (fb[k] - fb[k - 1]));
+        }
+    }
+
+    // Drip bursts run at a fixed duty, so only the drip sweep says anything about the range.
+    curve.dripRange = sw.dripRange ? sw.dripRange : CAL_DRIP_RANGE_DEFAULT;
+
+    curves[channel]     = curve;
+    calibrated[channel] = true;
+
+    char key[8];
+    keyFor(channel, key);
+    prefs.begin("motorcal", false);
+    prefs.putBytes(key, &curve, sizeof(curve));
+    prefs.end();
+
+    log_i("Channel %u characterised: start %u, full %u, drip range %u", channel,
+          curve.startDuty, curve.fullDuty, curve.dripRange);
+    return true;
+}
+
+uint16_t MotorCal_begin(uint8_t channel, uint32_t nowMs)
+{
+    if (channel >= MOTOR_CHANNEL_COUNT) return 0;
+
+    sweeps[channel].phase     = CAL_PHASE_BASELINE;
+    sweeps[channel].step      = 0;
+    sweeps[channel].dripStep  = 0;
+    sweeps[channel].dripRange = 0;
+    openWindow(channel, nowMs);
+    return 0;
+}
+
+/**
+ * @brief Judges the drops counted at the current burst rate and moves to the next rate.
+ *
+ * @return True when the drip sweep is over.
+ */
+static bool dripStepDone(uint8_t channel, uint32_t nowMs)
+{
+    SweepState& sw = sweeps[channel];
+
+    const uint32_t drops    = dropCount[channel] - sw.dropsAtStart;
+    const uint32_t bursts   = CAL_DRIP_WINDOW_MS / dripPeriodAt(sw.dripStep);
+    const uint32_t diff     = drops > bursts ? drops - bursts : bursts - drops;
+    const bool     separate = diff * 100 <= bursts * CAL_DRIP_TOLERANCE_PCT;
+
+    log_d("Channel %u drip %u: %lu drops for %lu bursts", channel, dripSpeedAt(sw.dripStep),
+          (unsigned long)drops, (unsigned long)bursts);
+
+    if (!separate)
+    {
+        // The slowest rate failing means the drops are not being seen properly: keep the default.
+        if (sw.dripStep == 1)
+            log_w("Channel %u: drops not separate at the slowest rate, drip range not measured", channel);
+        return true;
+    }
+
+    sw.dripRange = dripSpeedAt(sw.dripStep);
+
+    if (sw.dripStep == CAL_DRIP_STEPS)
+        return true;
+
+    sw.dripStep++;
+    sw.phase        = CAL_PHASE_DRIP_SETTLING;
+    sw.phaseStartMs = nowMs;
+    return false;
+}
+
+MotorCalResult MotorCal_update(uint8_t channel, uint32_t nowMs, uint16_t* duty, uint32_t* dripPeriodMs)
+{
+    if (channel >= MOTOR_CHANNEL_COUNT || sweeps[channel].phase == CAL_PHASE_IDLE)
+        return CAL_FAILED;
+
+    SweepState& sw      = sweeps[channel];
+    uint32_t    elapsed = nowMs - sw.phaseStartMs;
+
+    if (usesCurrent(channel) && (sw.phase == CAL_PHASE_BASELINE || sw.phase == CAL_PHASE_SAMPLING))
+    {
+        sw.sampleSum += analogReadMilliVolts(PIN_MOTOR_CURRENT[channel]);
+        sw.sampleN++;
+    }
+
+    switch (sw.phase)
+    {
+        case CAL_PHASE_BASELINE:
+            if (elapsed >= CAL_BASELINE_MS)
+            {
+                sw.feedback[0]  = windowValue(channel);
+                sw.step         = 1;
+                sw.phase        = CAL_PHASE_SETTLING;
+                sw.phaseStartMs = nowMs;
+            }
+            break;
+
+        case CAL_PHASE_SETTLING:
+            if (elapsed >= CAL_SETTLE_MS)
+            {
+                sw.phase = CAL_PHASE_SAMPLING;
+                openWindow(channel, nowMs);
+            }
+            break;
+
+        case CAL_PHASE_SAMPLING:
+        {
+            uint32_t windowMs = usesCurrent(channel) ? CAL_CURRENT_WINDOW_MS : CAL_DROP_WINDOW_MS;
+            if (elapsed < windowMs)
+                break;
+
+            sw.feedback[sw.step] = windowValue(channel);
+
+            if (sw.step < CAL_SWEEP_STEPS)
+            {
+                sw.step++;
+                sw.phase        = CAL_PHASE_SETTLING;
+                sw.phaseStartMs = nowMs;
+                break;
+            }
+
+            if (!hasDropSensor(channel))
+            {
+                sw.phase = CAL_PHASE_IDLE;
+                return buildCurve(channel) ? CAL_DONE : CAL_FAILED;
+            }
+
+            sw.dripStep     = 1;
+            sw.phase        = CAL_PHASE_DRIP_SETTLING;
+            sw.phaseStartMs = nowMs;
+            break;
+        }
+
+        case CAL_PHASE_DRIP_SETTLING:
+            if (elapsed >= CAL_DRIP_SETTLE_MS)
+            {
+                sw.phase = CAL_PHASE_DRIP_SAMPLING;
+                openWindow(channel, nowMs);
+            }
+            break;
+
+        case CAL_PHASE_DRIP_SAMPLING:
+            if (elapsed < CAL_DRIP_WINDOW_MS)
+                break;
+
+            if (dripStepDone(channel, nowMs))
+            {
+                sw.phase = CAL_PHASE_IDLE;
+                return buildCurve(channel) ? CAL_DONE : CAL_FAILED;
+            }
+            break;
+
+        case CAL_PHASE_IDLE:
+            return CAL_FAILED;
+    }
+
+    const bool dripping = (sw.phase == CAL_PHASE_DRIP_SETTLING || sw.phase == CAL_PHASE_DRIP_SAMPLING);
+
+    *duty         = dripping ? 0 : dutyAt(sw.step);
+    *dripPeriodMs = dripping ? dripPeriodAt(sw.dripStep) : 0;
+    return CAL_RUNNING;
+}
+
+void MotorCal_abort(uint8_t channel)
+{
+    if (channel < MOTOR_CHANNEL_COUNT)
+        sweeps[channel].phase = CAL_PHASE_IDLE;
+}
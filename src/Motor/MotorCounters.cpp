@@ -0,0 +1,145 @@
+/**
+ * @file MotorCounters.cpp
+ * @brief Delivered-dose accumulator implementation.
+ *
+ * Counters are updated from TaskMotor, summed over all pump channels, and
+ * read from the UI task, so every access is guarded by `countersLock`.
+ * NVS is only touched from `MotorCounters_service()` / `MotorCounters_flush()`,
+ * which run in TaskMotor.
+ */
+#include "Motor/MotorCounters.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <esp_attr.h>
+
+static Preferences prefs;
+
+static portMUX_TYPE countersLock = portMUX_INITIALIZER_UNLOCKED;
+
+/** @brief Counters since the last cold boot. Kept across deep sleep. */
+RTC_DATA_ATTR static MotorCounters sessionCounters;
+
+/** @brief Lifetime counters as last written to NVS. */
+static MotorCounters storedCounters = {};
+
+/** @brief Counters accumulated since the last NVS flush. */
+static MotorCounters pendingCounters = {};
+
+/** @brief Purge milliseconds not yet folded into a whole second. */
+static uint32_t purgeRemainderMs = 0;
+
+/** @brief True when `pendingCounters` holds unflushed values. */
+static bool dirty = false;
+
+/** @brief `millis()` timestamp of the last NVS flush. */
+static uint32_t lastFlushMs = 0;
+
+static void addCounters(MotorCounters& dst, const MotorCounters& src)
+{
+    dst.pulses         += src.pulses;
+    dst.onMs           += src.onMs;
+    dst.cleaningCycles += src.cleaningCycles;
+    dst.purgeSeconds   += src.purgeSeconds;
+}
+
+void MotorCounters_init()
+{
+    prefs.begin("motorstat", true);
+    storedCounters.pulses         = prefs.getUInt("pulses", 0);
+    storedCounters.onMs           = prefs.getULong64("onMs", 0);
+    storedCounters.cleaningCycles = prefs.getUInt("cycles", 0);
+    storedCounters.purgeSeconds   = prefs.getUInt("purgeS", 0);
+    prefs.end();
+
+    lastFlushMs = millis();
+}
+
+void MotorCounters_addPulse()
+{
+    portENTER_CRITICAL(&countersLock);
+    sessionCounters.pulses++;
+    pendingCounters.pulses++;
+    dirty = true;
+    portEXIT_CRITICAL(&countersLock);
+}
+
+void MotorCounters_addOnTime(uint32_t ms)
+{
+    if (ms == 0) return;
+
+    portENTER_CRITICAL(&countersLock);
+    sessionCounters.onMs += ms;
+    pendingCounters.onMs += ms;
+    dirty = true;
+    portEXIT_CRITICAL(&countersLock);
+}
+
+void MotorCounters_addCleaningCycle()
+{
+    portENTER_CRITICAL(&countersLock);
+    sessionCounters.cleaningCycles++;
+    pendingCounters.cleaningCycles++;
+    dirty = true;
+    portEXIT_CRITICAL(&countersLock);
+}
+
+void MotorCounters_addPurgeTime(uint32_t ms)
+{
+    portENTER_CRITICAL(&countersLock);
+    purgeRemainderMs += ms;
+    uint32_t seconds  = purgeRemainderMs / 1000;
+    purgeRemainderMs %= 1000;
+    sessionCounters.purgeSeconds += seconds;
+    pendingCounters.purgeSeconds += seconds;
+    if (seconds > 0) dirty = true;
+    portEXIT_CRITICAL(&countersLock);
+}
+
+void MotorCounters_flush()
+{
+    MotorCounters total;
+
+    portENTER_CRITICAL(&countersLock);
+    if (!dirty)
+    {
+        portEXIT_CRITICAL(&countersLock);
+        return;
+    }
+    addCounters(storedCounters, pendingCounters);
+    pendingCounters = {};
+    dirty = false;
+    total = storedCounters;
+    portEXIT_CRITICAL(&countersLock);
+
+    prefs.begin("motorstat", false);
+    prefs.putUInt("pulses",     total.pulses);
+    prefs.putULong64("onMs",    total.onMs);
+    prefs.putUInt("cycles",     total.cleaningCycles);
+    prefs.putUInt("purgeS",     total.purgeSeconds);
+    prefs.end();
+
+    lastFlushMs = millis();
+}
+
+void MotorCounters_service(bool motorIdle)
+{
+    if (!dirty) return;
+
+    uint32_t age = millis() - lastFlushMs;
+
+    if ((motorIdle && age >= COUNTERS_FLUSH_MIN_INTERVAL_MS) || age >= COUNTERS_FLUSH_MAX_INTERVAL_MS)
+        MotorCounters_flush();
+}
+
+void MotorCounters_get(MotorCounters* session, MotorCounters* lifetime)
+{
+    portENTER_CRITICAL(&countersLock);
+    if (session)
+        *session = sessionCounters;
+    if (lifetime)
+    {
+        *lifetime = storedCounters;
+        addCounters(*lifetime, pendingCounters);
+    }
+    portEXIT_CRITICAL(&countersLock);
+}
@@ -0,0 +1,73 @@
+/**
+ * @file MotorStatus.cpp
+ * @brief Sequence-lock implementation of the motor status snapshots.
+ *
+ * Each channel's sequence counter is odd while a publish is in progress.
+ * Publishers serialise on `writerLock`; readers only spin on the counter of
+ * the channel they read.
+ */
+#include "Motor/MotorStatus.h"
+#include <Arduino.h>
+#include <atomic>
+
+/** @brief Published snapshot of one pump channel. */
+struct StatusSlot {
+    std::atomic<uint32_t> sequence;
+    MotorStatus           snapshot;
+    uint32_t              publishedAtMs;
+};
+
+static StatusSlot slots[MOTOR_CHANNEL_COUNT] = {};
+
+static portMUX_TYPE writerLock = portMUX_INITIALIZER_UNLOCKED;
+
+void MotorStatus_publish(uint8_t channel, const MotorStatus& status)
+{
+    if (channel >= MOTOR_CHANNEL_COUNT) return;
+
+    StatusSlot& slot = slots[channel];
+    uint32_t    now  = millis();
+
+    portENTER_CRITICAL(&writerLock);
+
+    uint32_t seq = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.snapshot      = status;
+    slot.publishedAtMs = now;
+
+    slot.sequence.store(seq + 2, std::memory_order_release);
+
+    portEXIT_CRITICAL(&writerLock);
+}
+
+void MotorStatus_get(uint8_t channel, MotorStatus* out)
+{
+    if (channel >= MOTOR_CHANNEL_COUNT)
+    {
+        *out = {};
+        return;
+    }
+
+    const StatusSlot& slot = slots[channel];
+    uint32_t seqBefore;
+    uint32_t seqAfter;
+    uint32_t atMs;
+
+    do
+    {
+        seqBefore = slot.sequence.load(std::memory_order_acquire);
+        *out      = slot.snapshot;
+        atMs      = slot.publishedAtMs;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        seqAfter  = slot.sequence.load(std::memory_order_relaxed);
+    }
+    while ((seqBefore & 1) || seqBefore != seqAfter);
+
+    if (!out->paused && out->remainingMs > 0)
+    {
+        uint32_t elapsed = millis() - atMs;
+        out->remainingMs = (elapsed < out->remainingMs) ? out->remainingMs - elapsed : 0;
+    }
+}
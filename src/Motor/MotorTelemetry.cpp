@@ -0,0 +1,72 @@
+/**
+ * @file MotorTelemetry.cpp
+ * @brief Per-pulse motor telemetry ring buffer implementation.
+ *
+ * Producers serialise on a short spinlock so the buffer stays safe to feed
+ * from more than one task. The consumer side is lock-free:
+ * it only reads `head` (acquire) and publishes `tail` (release).
+ */
+#include "Motor/MotorTelemetry.h"
+#include <Arduino.h>
+#include <atomic>
+
+static MotorTelemetryRecord ring[TELEMETRY_CAPACITY];
+
+static std::atomic<uint32_t> head{0};
+static std::atomic<uint32_t> tail{0};
+static std::atomic<uint32_t> droppedCount{0};
+
+static uint16_t nextSeq = 0;
+
+static portMUX_TYPE producerLock = portMUX_INITIALIZER_UNLOCKED;
+
+void MotorTelemetry_record(uint8_t channel, MotorTelemetryKind kind, uint16_t duty,
+                           uint16_t onWidthMs, int32_t latenessUs, MotorCmdType source)
+{
+    uint32_t now = micros();
+
+    portENTER_CRITICAL(&producerLock);
+
+    uint16_t seq = nextSeq++;
+    uint32_t h   = head.load(std::memory_order_relaxed);
+
+    if (h - tail.load(std::memory_order_acquire) >= TELEMETRY_CAPACITY)
+    {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+        portEXIT_CRITICAL(&producerLock);
+        return;
+    }
+
+    MotorTelemetryRecord& rec = ring[h & (TELEMETRY_CAPACITY - 1)];
+    rec.timestampUs = now;
+    rec.latenessUs  = latenessUs;
+    rec.duty        = duty;
+    rec.onWidthMs   = onWidthMs;
+    rec.kind        = (uint8_t)((channel << 4) | (kind & 0x0F));
+    rec.source      = (uint8_t)source;
+    rec.seq         = seq;
+
+    head.store(h + 1, std::memory_order_release);
+
+    portEXIT_CRITICAL(&producerLock);
+}
+
+uint32_t MotorTelemetry_read(MotorTelemetryRecord* out, uint32_t maxRecords)
+{
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t h = head.load(std::memory_order_acquire);
+
+    uint32_t count = h - t;
+    if (count > maxRecords) count = maxRecords;
+
+    for (uint32_t i = 0; i < count; i++)
+        out[i] = ring[(t + i) & (TELEMETRY_CAPACITY - 1)];
+
+    tail.store(t + count, std::memory_order_release);
+    return count;
+}
+
+uint32_t MotorTelemetry_dropped()
+{
+    return droppedCount.load(std::memory_order_relaxed);
+}
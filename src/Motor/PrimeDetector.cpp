@@ -0,0 +1,123 @@
+/**
+ * @file PrimeDetector.cpp
+ * @brief End-of-line detection implementation.
+ */
+#include "Motor/PrimeDetector.h"
+#include "Config/pins.h"
+#include <Arduino.h>
+
+/** @brief Current detection phases. */
+enum PrimePhase {
+    PRIME_SETTLING, ///< Waiting for the ramp and settle time to pass.
+    PRIME_LEARNING, ///< Averaging the air-running baseline.
+    PRIME_WATCHING  ///< Comparing samples against the baseline.
+};
+
+/** @brief Detection state of one pump channel. */
+struct PrimeState {
+    PrimePhase phase;
+    uint32_t   phaseStartMs;
+    uint32_t   settleEndMs;
+    uint32_t   baselineSum;
+    uint32_t   baselineN;
+    uint32_t   baselineMv;
+    uint32_t   conditionSinceMs; ///< `millis()` time at which the detection condition first held; 0 if not holding.
+};
+
+static PrimeState primeStates[MOTOR_CHANNEL_COUNT] = {};
+
+void PrimeDetector_init()
+{
+    for (int ch = 0; ch < MOTOR_CHANNEL_COUNT; ch++)
+    {
+        if (PIN_LINE_SENSOR[ch] >= 0)
+            pinMode(PIN_LINE_SENSOR[ch], INPUT_PULLUP);
+
+        if (PIN_MOTOR_CURRENT[ch] >= 0)
+            analogSetPinAttenuation(PIN_MOTOR_CURRENT[ch], ADC_11db);
+    }
+}
+
+bool PrimeDetector_available(uint8_t channel)
+{
+    if (channel >= MOTOR_CHANNEL_COUNT) return false;
+
+    return PIN_LINE_SENSOR[channel] >= 0 || PIN_MOTOR_CURRENT[channel] >= 0;
+}
+
+void PrimeDetector_start(uint8_t channel, uint32_t nowMs, uint32_t rampEndMs)
+{
+    if (channel >= MOTOR_CHANNEL_COUNT) return;
+
+    PrimeState& st = primeStates[channel];
+    st.phase            = PRIME_SETTLING;
+    st.phaseStartMs     = nowMs;
+    st.settleEndMs      = rampEndMs + PRIME_SETTLE_MS;
+    st.baselineSum      = 0;
+    st.baselineN        = 0;
+    st.baselineMv       = 0;
+    st.conditionSinceMs = 0;
+}
+
+/**
+ * @brief Tracks how long `condition` has held continuously.
+ *
+ * @return True once it has held for PRIME_CONFIRM_MS.
+ */
+static bool confirm(PrimeState& st, bool condition, uint32_t nowMs)
+{
+    if (!condition)
+    {
+        st.conditionSinceMs = 0;
+        return false;
+    }
+
+    if (st.conditionSinceMs == 0)
+        st.conditionSinceMs = nowMs ? nowMs : 1;
+
+    return nowMs - st.conditionSinceMs >= PRIME_CONFIRM_MS;
+}
+
+bool PrimeDetector_update(uint8_t channel, uint32_t nowMs)
+{
+    if (channel >= MOTOR_CHANNEL_COUNT) return false;
+
+    PrimeState& st = primeStates[channel];
+
+    if (PIN_LINE_SENSOR[channel] >= 0)
+        return confirm(st, digitalRead(PIN_LINE_SENSOR[channel]) == LOW, nowMs);
+
+    if (PIN_MOTOR_CURRENT[channel] < 0)
+        return false;
+
+    uint32_t mv = analogReadMilliVolts(PIN_MOTOR_CURRENT[channel]);
+
+    switch (st.phase)
+    {
+        case PRIME_SETTLING:
+            if ((int32_t)(nowMs - st.settleEndMs) >= 0)
+            {
+                st.phase        = PRIME_LEARNING;
+                st.phaseStartMs = nowMs;
+            }
+            return false;
+
+        case PRIME_LEARNING:
+            st.baselineSum += mv;
+            st.baselineN++;
+            if (nowMs - st.phaseStartMs >= PRIME_BASELINE_MS)
+            {
+                st.baselineMv = st.baselineSum / st.baselineN;
+                st.phase      = PRIME_WATCHING;
+            }
+            return false;
+
+        case PRIME_WATCHING:
+        {
+            uint32_t delta = (mv > st.baselineMv) ? (mv - st.baselineMv) : (st.baselineMv - mv);
+            return confirm(st, delta * 100UL > st.baselineMv * PRIME_CURRENT_CHANGE_PCT, nowMs);
+        }
+    }
+
+    return false;
+}
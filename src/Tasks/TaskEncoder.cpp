@@ -2,26 +2,68 @@
  * @file TaskEncoder.cpp
  * @brief Rotary encoder and push-button task manager.
  *
- * This module reads a rotary encoder and its push-button,
- * performs software debouncing, long-press detection and sends
- * UI events to the UI queue.
+ * Quadrature decoding runs in the PCNT peripheral: both encoder edges are
+ * counted in hardware through the glitch filter, and the counter limits
+ * are set to one detent so every detent raises an interrupt. With
+ * ENCODER_USE_PCNT set to 0, CLK and DT edge interrupts feed the table
+ * decoder (Input/QuadratureDecoder.h) instead, which rejects bounce and
+ * skipped states in software. The push-button is interrupt-driven as well.
+ *
+ * TaskEncoder blocks on its task notification until one of those
+ * interrupts fires (or a gesture times out), debounces the button, runs
+ * the gesture recogniser (Input/Gesture.h) and sends UI events to the
+ * input ring. No time is spent polling while the knob is untouched.
+ *
+ * Timestamps are taken in the ISRs, so the UI sees when the knob actually
+ * moved rather than when the event was dequeued. All detents captured
+ * since the last wake-up are sent as one rotation event.
  */
 #include "Tasks/TaskEncoder.h"
 #include "Config/pins.h"
+#include "Input/InputRing.h"
+#include "Input/Gesture.h"
+#include <esp_attr.h>
+#include <atomic>
+
+#if ENCODER_USE_PCNT
+#include <driver/pcnt.h>
+
+/** @brief PCNT unit used for the encoder. */
+static constexpr pcnt_unit_t ENCODER_PCNT_UNIT = PCNT_UNIT_0;
 
 /**
- * @brief Last sampled 2-bit encoder state: (PIN_CLK << 1) | PIN_DT.
+ * @brief PCNT glitch filter length in APB clock cycles (80 MHz).
  *
- * Both pins must be tracked
- * simultaneously to correctly decode EC11 quadrature output.
- * 0xFF is used as the sentinel "uninitialized" value.
+ * Pulses shorter than ~12.5 µs are ignored. The maximum accepted by the
+ * hardware is 1023.
  */
-static uint8_t lastEncoderState = 0xFF;
+static constexpr uint16_t ENCODER_FILTER_CYCLES = 1000;
+#else
+/** @brief Table decoder state, owned by encoderIsr(). */
+static QuadDecoder encoderDecoder;
+#endif
+
+/** @brief Notification bit: the encoder crossed a detent. */
+static constexpr uint32_t NOTIFY_ENCODER = 1UL << 0;
+
+/** @brief Notification bit: the push-button changed level. */
+static constexpr uint32_t NOTIFY_BUTTON  = 1UL << 1;
+
+/** @brief Handle of TaskEncoder, target of the ISR notifications. */
+static TaskHandle_t encoderTaskHandle = nullptr;
 
 /**
- * @brief Timestamp of last valid encoder movement (ms).
+ * @brief Detents captured by the encoder ISR and not yet turned into events.
+ *
+ * Positive values are clockwise.
  */
-static uint32_t lastEncoderMoveMs = 0;
+static std::atomic<int32_t> pendingDetents{0};
+
+/** @brief `millis()` at which the encoder ISR captured the last detent. */
+static std::atomic<uint32_t> lastDetentMs{0};
+
+/** @brief `millis()` at which the button ISR saw the last edge. */
+static std::atomic<uint32_t> lastButtonEdgeMs{0};
 
 /**
  * @brief Last sampled button state.
@@ -29,158 +71,267 @@ static uint32_t lastEncoderMoveMs = 0;
 static bool lastButtonState = HIGH;
 
 /**
- * @brief Timestamp when button was pressed (ms).
+ * @brief Click, double-click, long-press and press-rotate recogniser.
  */
-static uint32_t buttonPressTime = 0;
+static Gesture gesture;
 
 /**
- * @brief Flag indicating that long press event has been fired.
+ * @brief Button debounce time in milliseconds.
  */
-static bool longPressFired = false;
+static constexpr uint32_t DEBOUNCE_MS   = 5;
 
+#if ENCODER_USE_PCNT
 /**
- * @brief Encoder debounce time in milliseconds.
+ * @brief PCNT limit interrupt: one detent in either direction.
+ *
+ * The hardware resets the counter to zero when a limit is reached, so the
+ * next detent starts from a clean count.
  */
-static constexpr uint32_t DEBOUNCE_MS   = 5;
+static void IRAM_ATTR encoderIsr(void*)
+{
+    uint32_t status = 0;
+    pcnt_get_event_status(ENCODER_PCNT_UNIT, &status);
+
+    if (status & PCNT_EVT_H_LIM)
+        pendingDetents.fetch_add(1, std::memory_order_relaxed);
+    else if (status & PCNT_EVT_L_LIM)
+        pendingDetents.fetch_sub(1, std::memory_order_relaxed);
+    else
+        return;
+
+    lastDetentMs.store(millis(), std::memory_order_relaxed);
 
+    BaseType_t woken = pdFALSE;
+    xTaskNotifyFromISR(encoderTaskHandle, NOTIFY_ENCODER, eSetBits, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+#else
 /**
- * @brief Button long-press threshold in milliseconds.
+ * @brief Samples CLK/DT as a 2-bit decoder state.
  */
-static constexpr uint32_t LONG_PRESS_MS = 1000;
+static inline uint8_t IRAM_ATTR readEncoderPins()
+{
+    return (uint8_t)((digitalRead(PIN_CLK) << 1) | digitalRead(PIN_DT));
+}
 
 /**
- * @brief Reads the EC11 rotary encoder using a quadrature state machine.
+ * @brief CLK/DT edge interrupt: feeds the table decoder.
  *
- * The EC11 detent positions alternate between two states:
- *   - STATE_DT_ONLY  (0b01): only B/DT closed  → A=HIGH, B=LOW
- *   - STATE_CLK_ONLY (0b10): only A/CLK closed  → A=LOW,  B=HIGH
- *
- * Between consecutive detents the encoder passes through either
- * 0b00 (CW path) or 0b11 (CCW path). Direction is determined by
- * which intermediate state was last seen before arriving at a detent:
+ * Both pins share this handler. Each call samples both pins, so an edge
+ * whose interrupt is merged with the next one still ends in the right
+ * state.
+ */
+static void IRAM_ATTR encoderIsr(void*)
+{
+    int8_t detent = QuadDecoder_update(&encoderDecoder, readEncoderPins());
+
+    if (detent == 0)
+        return;
+
+    pendingDetents.fetch_add(detent, std::memory_order_relaxed);
+    lastDetentMs.store(millis(), std::memory_order_relaxed);
+
+    BaseType_t woken = pdFALSE;
+    xTaskNotifyFromISR(encoderTaskHandle, NOTIFY_ENCODER, eSetBits, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+#endif
+
+/**
+ * @brief Push-button edge interrupt.
+ */
+static void IRAM_ATTR buttonIsr(void*)
+{
+    lastButtonEdgeMs.store(millis(), std::memory_order_relaxed);
+
+    BaseType_t woken = pdFALSE;
+    xTaskNotifyFromISR(encoderTaskHandle, NOTIFY_BUTTON, eSetBits, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief Posts the events produced by the gesture recogniser to the input ring.
  *
- *   Arrived at 0b10 from 0b00  →  CW   (ENC_RIGHT)
- *   Arrived at 0b10 from 0b11  →  CCW  (ENC_LEFT)
- *   Arrived at 0b01 from 0b11  →  CW   (ENC_RIGHT)
- *   Arrived at 0b01 from 0b00  →  CCW  (ENC_LEFT)
+ * A full ring drops and counts an event rather than stalling or
+ * asserting, so input can never take the pump down.
+ */
+static void sendInputEvents(const InputEvent* events, uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++)
+        InputRing_push(events[i]);
+}
+
+/**
+ * @brief Feeds the detents captured by the encoder ISR to the gesture recogniser.
  *
- * Events are posted to xUIQueue only once per detent and only after
- * the debounce interval has elapsed.
+ * All of them form one ENC_ROTATE (or ENC_PRESS_ROTATE) event.
  */
 static void readEncoder()
 {
-    /* Build current 2-bit state from both encoder pins. */
-    uint8_t A     = (uint8_t)digitalRead(PIN_CLK);   /* 0 = closed, 1 = open */
-    uint8_t B     = (uint8_t)digitalRead(PIN_DT);    /* 0 = closed, 1 = open */
-    uint8_t state = (A << 1) | B;
+    int32_t detents = pendingDetents.exchange(0, std::memory_order_relaxed);
 
-    /* Nothing changed – nothing to do. */
-    if (state == lastEncoderState)
-    {
+    if (detents == 0)
         return;
-    }
-
-    uint32_t now = millis();
-
-    /*
-     * Fire only when reaching a detent state and the debounce window
-     * has passed. Intermediate states (0b00 and 0b11) are stored in
-     * lastEncoderState to carry direction information to the next detent.
-     */
-    if ((state == 0b10 || state == 0b01) &&
-        (now - lastEncoderMoveMs > DEBOUNCE_MS))
-    {
-        /*
-         * Validate that we arrived from a known intermediate state.
-         * Spurious transitions (e.g. noise) that skip states are ignored.
-         */
-        if (lastEncoderState == 0b00 || lastEncoderState == 0b11)
-        {
-            /* Decode direction from (previous intermediate, current detent). */
-            bool cw = ((state == 0b10 && lastEncoderState == 0b00) ||
-                       (state == 0b01 && lastEncoderState == 0b11));
 
-            EncoderEvent evt = cw ? ENC_RIGHT : ENC_LEFT;
-            configASSERT(xQueueSend(xUIQueue, &evt, 0) == pdPASS);
-            lastEncoderMoveMs = now;
-        }
-    }
+    if (detents > INT16_MAX) detents = INT16_MAX;
+    if (detents < -INT16_MAX) detents = -INT16_MAX;
 
-    lastEncoderState = state;
+    InputEvent events[GESTURE_MAX_EVENTS];
+    uint8_t count = Gesture_rotate(&gesture, (int16_t)detents,
+                                   lastDetentMs.load(std::memory_order_relaxed), events);
+    sendInputEvents(events, count);
 }
 
 /**
- * @brief Reads button state and generates short/long press events.
+ * @brief Feeds a debounced button level change to the gesture recogniser.
  */
 static void readButton()
 {
     bool currentState = digitalRead(PIN_SW);
-    uint32_t now      = millis();
 
-    /* Falling edge: button pressed */
-    if (lastButtonState == HIGH && currentState == LOW)
-    {
-        buttonPressTime = now;
-        longPressFired  = false;
-    }
+    if (currentState == lastButtonState)
+        return;
 
-    /* Button held: long press detection */
-    if (currentState == LOW && !longPressFired)
-    {
-        if (now - buttonPressTime >= LONG_PRESS_MS)
-        {
-            EncoderEvent evt = BTN_LONG;
-            configASSERT(xQueueSend(xUIQueue, &evt, 0) == pdPASS);
-            longPressFired = true;
-        }
-    }
+    lastButtonState = currentState;
 
-    /* Rising edge: button released */
-    if (lastButtonState == LOW && currentState == HIGH)
-    {
-        if (!longPressFired)
-        {
-            EncoderEvent evt = BTN_SHORT;
-            configASSERT(xQueueSend(xUIQueue, &evt, 0) == pdPASS);
-        }
-    }
+    InputEvent events[GESTURE_MAX_EVENTS];
+    uint8_t count = Gesture_button(&gesture, currentState == LOW,
+                                   lastButtonEdgeMs.load(std::memory_order_relaxed), events);
+    sendInputEvents(events, count);
+}
 
-    lastButtonState = currentState;
+/**
+ * @brief Reports long presses, repeats and single clicks that have become due.
+ */
+static void serviceGesture()
+{
+    InputEvent events[GESTURE_MAX_EVENTS];
+    uint8_t count = Gesture_tick(&gesture, millis(), events);
+    sendInputEvents(events, count);
 }
 
 /**
- * @brief Encoder polling task.
+ * @brief Returns how long the task may sleep before a gesture times out.
+ */
+static TickType_t nextGestureDeadline()
+{
+    uint32_t ms = Gesture_msUntilDeadline(&gesture, millis());
+
+    if (ms == UINT32_MAX)
+        return portMAX_DELAY;
+
+    return pdMS_TO_TICKS(ms);
+}
+
+/**
+ * @brief Encoder event task.
  *
- * Samples encoder rotation and push-button state at 5 ms intervals.
- * Sends UI events to xUIQueue.
+ * Sleeps until the encoder or button interrupt fires, or until a pending
+ * gesture times out. Sends UI events to the input ring.
  *
  * @param pvParameters Unused.
  */
 void TaskEncoder(void *pvParameters)
 {
-    /* Capture initial state so the first real transition is detected. */
-    uint8_t A         = (uint8_t)digitalRead(PIN_CLK);
-    uint8_t B         = (uint8_t)digitalRead(PIN_DT);
-    lastEncoderState  = (A << 1) | B;
-    lastButtonState   = digitalRead(PIN_SW);
-    buttonPressTime   = millis();
-    lastEncoderMoveMs = 0;
-    longPressFired    = false;
+    lastButtonState = digitalRead(PIN_SW);
+    Gesture_init(&gesture, GESTURE_CONFIG_DEFAULT);
 
     for (;;)
     {
-        readEncoder();
-        readButton();
-        vTaskDelay(pdMS_TO_TICKS(5));
+        uint32_t bits = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &bits, nextGestureDeadline());
+
+        /* Let contact bounce die out before sampling the new level. */
+        if (bits & NOTIFY_BUTTON)
+            vTaskDelay(pdMS_TO_TICKS(DEBOUNCE_MS));
+
+        /* Feed edges in the order they happened so press-rotate is recognised. */
+        uint32_t edgeMs   = lastButtonEdgeMs.load(std::memory_order_relaxed);
+        uint32_t detentMs = lastDetentMs.load(std::memory_order_relaxed);
+
+        if ((bits & NOTIFY_BUTTON) && (int32_t)(detentMs - edgeMs) >= 0)
+        {
+            readButton();
+            readEncoder();
+        }
+        else
+        {
+            readEncoder();
+            readButton();
+        }
+
+        serviceGesture();
     }
 }
 
+#if ENCODER_USE_PCNT
 /**
- * @brief Initializes encoder GPIOs and creates encoder task.
+ * @brief Configures PCNT quadrature decoding of CLK/DT.
+ *
+ * Both channels count both edges of their input, with the other input as
+ * direction control, giving 4× decoding. The counter limits are
+ * ±ENCODER_COUNTS_PER_DETENT so each detent raises one limit event.
+ */
+static void encoderPcntInit()
+{
+    pcnt_config_t config = {
+        .pulse_gpio_num = PIN_CLK,
+        .ctrl_gpio_num  = PIN_DT,
+        .lctrl_mode     = PCNT_MODE_REVERSE,
+        .hctrl_mode     = PCNT_MODE_KEEP,
+        .pos_mode       = PCNT_COUNT_DEC,
+        .neg_mode       = PCNT_COUNT_INC,
+        .counter_h_lim  = ENCODER_COUNTS_PER_DETENT,
+        .counter_l_lim  = -ENCODER_COUNTS_PER_DETENT,
+        .unit           = ENCODER_PCNT_UNIT,
+        .channel        = PCNT_CHANNEL_0
+    };
+    ESP_ERROR_CHECK(pcnt_unit_config(&config));
+
+    config.pulse_gpio_num = PIN_DT;
+    config.ctrl_gpio_num  = PIN_CLK;
+    config.pos_mode       = PCNT_COUNT_INC;
+    config.neg_mode       = PCNT_COUNT_DEC;
+    config.channel        = PCNT_CHANNEL_1;
+    ESP_ERROR_CHECK(pcnt_unit_config(&config));
+
+    ESP_ERROR_CHECK(pcnt_set_filter_value(ENCODER_PCNT_UNIT, ENCODER_FILTER_CYCLES));
+    ESP_ERROR_CHECK(pcnt_filter_enable(ENCODER_PCNT_UNIT));
+
+    ESP_ERROR_CHECK(pcnt_event_enable(ENCODER_PCNT_UNIT, PCNT_EVT_H_LIM));
+    ESP_ERROR_CHECK(pcnt_event_enable(ENCODER_PCNT_UNIT, PCNT_EVT_L_LIM));
+
+    ESP_ERROR_CHECK(pcnt_counter_pause(ENCODER_PCNT_UNIT));
+    ESP_ERROR_CHECK(pcnt_counter_clear(ENCODER_PCNT_UNIT));
+
+    ESP_ERROR_CHECK(pcnt_isr_service_install(0));
+    ESP_ERROR_CHECK(pcnt_isr_handler_add(ENCODER_PCNT_UNIT, encoderIsr, nullptr));
+    ESP_ERROR_CHECK(pcnt_intr_enable(ENCODER_PCNT_UNIT));
+
+    ESP_ERROR_CHECK(pcnt_counter_resume(ENCODER_PCNT_UNIT));
+}
+#else
+/**
+ * @brief Configures table decoding of CLK/DT from edge interrupts.
+ */
+static void encoderGpioInit()
+{
+    QuadDecoder_init(&encoderDecoder, ENCODER_STEP_MODE, ENCODER_REST_STATES, readEncoderPins());
+
+    attachInterruptArg(PIN_CLK, encoderIsr, nullptr, CHANGE);
+    attachInterruptArg(PIN_DT,  encoderIsr, nullptr, CHANGE);
+}
+#endif
+
+/**
+ * @brief Initializes encoder inputs and creates encoder task.
  *
  * Encoder pins use plain INPUT because the PCB provides hardware
  * pull-ups and RC filters. The push-button uses INPUT_PULLUP as
  * the EC11 switch is active-low with no external pull-up.
+ *
+ * The task is created before the interrupts are enabled so the ISRs
+ * always have a valid notification target.
  */
 void TaskEncoder_init()
 {
@@ -194,8 +345,15 @@ void TaskEncoder_init()
         4096,
         nullptr,
         1,
-        nullptr,
+        &encoderTaskHandle,
         APP_CPU_NUM
     );
     configASSERT(taskCreated == pdPASS);
-}
\ No newline at end of file
+
+#if ENCODER_USE_PCNT
+    encoderPcntInit();
+#else
+    encoderGpioInit();
+#endif
+    attachInterruptArg(PIN_SW, buttonIsr, nullptr, CHANGE);
+}
@@ -2,20 +2,55 @@
  * @file TaskMotor.cpp
  * @brief Motor control task implementation.
  *
- * Implements two independent operating modes:
- * - **Drip mode** (`MOTOR_CMD_START_TIMED`): short high-amplitude PWM bursts
- *   timed by a dedicated FreeRTOS timer. Speed 1–100 maps hyperbolically to
- *   a burst period of 10 000–222 ms, covering the functional drip range of
- *   the physical hardware (0–45 % internal duty).
+ * Drives MOTOR_CHANNEL_COUNT independent pump channels (see pins.h). Every
+ * channel implements the same operating modes:
+ * - **Drip mode** (`MOTOR_CMD_START_TIMED`): short high-amplitude PWM bursts.
+ *   Speed 1–100 maps hyperbolically to a burst period of 10 000–222 ms,
+ *   covering the functional drip range of the physical hardware (0–45 %
+ *   internal duty).
  * - **Cleaning mode** (`MOTOR_CMD_CLEAN_*`): continuous high-speed PWM driven
  *   by cycling ON/OFF according to a `CleanProfile`.
+ * - **Purge mode** (`MOTOR_CMD_CLEAN_PURGE`): ramped continuous run that ends
+ *   on its duration or, optionally, as soon as PrimeDetector reports the
+ *   line full.
+ * - **Characterisation** (`MOTOR_CMD_CHARACTERISE`): duty sweep that
+ *   measures the pump's own speed curve through MotorCalibration.
+ *
+ * Speed-to-duty and drip mappings use each channel's MotorCalibration curve.
+ *
+ * All channels share one deadline scheduler inside TaskMotor: each pending
+ * phase change, kickstart end, purge tick and run timeout is a deadline on
+ * its channel, and the task blocks on `xMotorQueue` only until the earliest
+ * of them. No software timers are involved, so all channel state is owned
+ * by this task alone and the cost does not grow with channels × phases.
  */
 
 #include "Tasks/TaskMotor.h"
-
-/** @brief Duration of a full purge cycle in milliseconds. */
+#include "Motor/MotorCounters.h"
+#include "Motor/MotorTelemetry.h"
+#include "Motor/PrimeDetector.h"
+#include "Motor/MotorStatus.h"
+#include "Motor/MotorCalibration.h"
+#include <esp_timer.h>
+
+/** @brief Default (and maximum without detection) purge duration in milliseconds. */
 static constexpr uint32_t PURGE_DURATION_MS = 20000;
 
+/** @brief Default purge speed percentage. */
+static constexpr uint8_t PURGE_SPEED_DEFAULT = 100;
+
+/** @brief Default purge ramp-up time in milliseconds. */
+static constexpr uint16_t PURGE_RAMP_MS_DEFAULT = 1000;
+
+/** @brief Speed percentage the purge ramp starts from. */
+static constexpr uint8_t PURGE_RAMP_START_PERCENT = 1;
+
+/** @brief Purge ramp and end-of-line sampling period in milliseconds. */
+static constexpr uint32_t PURGE_TICK_MS = 20;
+
+/** @brief Idle wake-up period of TaskMotor for counter housekeeping. */
+static constexpr uint32_t COUNTERS_SERVICE_PERIOD_MS = 10000;
+
 /** @brief Default burst amplitude for drip mode. */
 static constexpr uint8_t DRIP_PULSE_DUTY_DEFAULT = 70;
 
@@ -27,26 +62,26 @@ static constexpr uint8_t DRIP_PULSE_DUTY_DEFAULT = 70;
  */
 static constexpr uint32_t DRIP_PULSE_MS_DEFAULT = 10;
 
-/**
- * @brief One-shot timer that fires after KICKSTART_MS to drop PWM to the
- *        target duty, ending the kickstart phase.
- */
-static TimerHandle_t kickstartTimer = nullptr;
-
-/** @brief Target LEDC duty to apply when the kickstart timer fires. */
-static uint32_t kickstartTargetDuty = 0;
-
-/** @brief Tracks whether the motor is currently spinning. */
-static bool motorRunning = false;
-
-/** @brief One-shot timer that stops the motor after a timed operation ends. */
-static TimerHandle_t motorTimeoutTimer = nullptr;
-
-/** @brief Periodic timer that drives ON/OFF cycles during cleaning sequences. */
-static TimerHandle_t motorCycleTimer = nullptr;
+/** @brief Deadline value meaning "nothing scheduled". */
+static constexpr int64_t NO_DEADLINE = INT64_MAX;
+
+/** @brief Runtime state for an active purge. */
+struct PurgeState {
+    bool     active;         ///< True while a purge is running.
+    uint8_t  speed;          ///< Target speed (0–100 %).
+    uint16_t rampMs;         ///< Ramp-up time from rest to `speed` (ms).
+    bool     stopWhenPrimed; ///< End as soon as the line is detected full.
+    bool     rampDone;       ///< True once `speed` has been reached.
+    int64_t  segmentStartUs; ///< Time at which the current run segment started.
+    int64_t  nextTickUs;     ///< Time of the next ramp / detection tick.
+    uint32_t elapsedMs;      ///< Run time of earlier segments (before a pause).
+};
 
-/** @brief Periodic timer that alternates burst ON/OFF phases in drip mode. */
-static TimerHandle_t dripTimer = nullptr;
+/** @brief Outcome of the last finished purge. */
+struct PurgeResult {
+    uint32_t durationMs; ///< Total run time, excluding pauses (ms).
+    bool     primed;     ///< True if it ended because the line was detected full.
+};
 
 /** @brief Cleaning sequence configuration profile. */
 struct CleanProfile
@@ -77,20 +112,18 @@ struct CleanState {
     MotorCmdType mode;       ///< Active cleaning command; MOTOR_CMD_STOP when idle.
     uint8_t      cyclesLeft; ///< Remaining ON/OFF cycles before completion.
     bool         isMotorOn;  ///< Whether the motor is currently in its ON phase.
-};
-
-static CleanState cleanState = {
-    .mode       = MOTOR_CMD_STOP,
-    .cyclesLeft = 0,
-    .isMotorOn  = false
+    int64_t      deadlineUs; ///< Scheduled time of the next phase change.
 };
 
 /**
  * @brief Runtime state for an active drip operation.
  *
- * The drip timer alternates between two phases:
- *  - ON  (`motorPhase == true`):  motor runs for `pulseMs` milliseconds.
- *  - OFF (`motorPhase == false`): motor is idle for `periodMs - pulseMs` ms.
+ * The generator alternates between two phases:
+ *  - ON  (`motorPhase == true`):  motor runs for exactly `pulseMs` milliseconds.
+ *  - OFF (`motorPhase == false`): motor idles until the next period starts.
+ *
+ * Periods are scheduled from `periodStartUs`, not from the time the previous
+ * phase actually ran, so scheduling latency does not accumulate into drift.
  */
 struct DripState {
     bool     active;           ///< True while a drip operation is running.
@@ -98,205 +131,467 @@ struct DripState {
     uint32_t pulseMs;          ///< Motor ON duration per cycle (burst width).
     uint8_t  pulseDutyPercent; ///< Burst amplitude as a linear duty percentage.
     bool     motorPhase;       ///< True during the ON phase, false during OFF.
+    int64_t  periodStartUs;    ///< Scheduled start of the current period.
+    int64_t  deadlineUs;       ///< Scheduled time of the next phase change.
+    uint32_t pulses;           ///< Pulses delivered since the drip run started.
+    bool     dosing;           ///< False for characterisation bursts, which are not counted as doses.
 };
 
-static DripState dripState = {
-    .active           = false,
-    .periodMs         = 0,
-    .pulseMs          = 0,
-    .pulseDutyPercent = 0,
-    .motorPhase       = false
+/**
+ * @brief Snapshot of a paused operation, restored by MOTOR_CMD_RESUME.
+ *
+ * Remainders are taken from the channel deadlines so the resumed operation
+ * finishes exactly when it would have without the pause.
+ */
+struct PauseState {
+    bool         paused;             ///< True while an operation is frozen.
+    MotorCmdType source;             ///< Command that started the frozen operation.
+    bool         hasTimeout;         ///< Whether a run timeout was armed.
+    uint32_t     timeoutRemainingMs; ///< Remaining overall run time (ms).
+    uint32_t     phaseRemainingMs;   ///< Remaining time of the current drip/clean phase (ms).
+    CleanState   clean;              ///< Frozen cleaning state (cycle index and phase).
+    DripState    drip;               ///< Frozen drip state (period and phase).
+    bool         purge;              ///< Whether a purge was running.
+    uint8_t      speed;              ///< Continuous speed for MOTOR_CMD_SET_SPEED runs.
+};
+
+/** @brief Runtime state for a characterisation sweep. */
+struct CalState {
+    bool    active;     ///< True while the sweep runs.
+    int64_t nextTickUs; ///< Time of the next sweep tick.
+};
+
+/** @brief Complete runtime state of one pump channel. */
+struct MotorChannel {
+    uint8_t        index;           ///< Channel number (0 … MOTOR_CHANNEL_COUNT-1).
+    ledc_channel_t ledc;            ///< LEDC channel driving this pump.
+    uint32_t       appliedDuty;     ///< LEDC duty currently applied.
+    uint32_t       onSinceMs;       ///< `millis()` at which the output last went non-zero.
+    bool           running;         ///< True while continuous PWM is applied by Motor_setSpeed().
+    bool           kickstartActive; ///< True while the kickstart boost is applied.
+    int64_t        kickstartEndUs;  ///< Time at which the kickstart boost ends.
+    uint32_t       targetDuty;      ///< Duty to apply once the kickstart ends.
+    MotorCmdType   source;          ///< Command that started the running operation.
+    uint8_t        continuousSpeed; ///< Speed of the last MOTOR_CMD_SET_SPEED, restored on resume.
+    bool           runTimed;        ///< True while a run timeout bounds the operation.
+    int64_t        runEndUs;        ///< Time at which the run timeout fires.
+    uint32_t       runTotalMs;      ///< Full duration of the running operation (ms); 0 when untimed.
+    CleanState     clean;           ///< Cleaning sequence state.
+    DripState      drip;            ///< Drip generator state.
+    PurgeState     purge;           ///< Purge state.
+    PurgeResult    lastPurge;       ///< Outcome of the last finished purge.
+    CalState       cal;             ///< Characterisation sweep state.
+    PauseState     pause;           ///< Frozen operation, if paused.
 };
 
+static MotorChannel channels[MOTOR_CHANNEL_COUNT];
+
+/** @brief Current time in microseconds since boot; never wraps in practice. */
+static inline int64_t nowUs()
+{
+    return esp_timer_get_time();
+}
+
 /**
- * @brief Maps a speed percentage to an LEDC duty value using a quadratic curve.
+ * @brief Writes a duty value to the channel's LEDC output.
  *
- * @param percent Speed in the range 0–100 %.
- * @return LEDC duty value in the range 0–MAX_DUTY.
+ * Every motor output change goes through here so that ON time is accounted
+ * for in MotorCounters on each non-zero → zero transition.
+ *
+ * @param ch   Pump channel.
+ * @param duty LEDC duty value in the range 0–MAX_DUTY.
  */
-static uint32_t speedToDuty(uint8_t percent)
+static void Motor_writeDuty(MotorChannel& ch, uint32_t duty)
 {
-    if (percent == 0)
-        return 0;
-
-    const float minDuty = 0.20f;
+    uint32_t now = millis();
 
-    float x = percent / 100.0f;
-    float y = minDuty + (1.0f - minDuty) * x * x;
+    if (ch.appliedDuty == 0 && duty > 0)
+        ch.onSinceMs = now;
+    else if (ch.appliedDuty > 0 && duty == 0)
+        MotorCounters_addOnTime(now - ch.onSinceMs);
 
-    return (uint32_t)(y * MAX_DUTY);
+    ch.appliedDuty = duty;
+    ledc_set_duty(LEDC_LOW_SPEED_MODE, ch.ledc, duty);
+    ledc_update_duty(LEDC_LOW_SPEED_MODE, ch.ledc);
 }
 
 /**
  * @brief Writes a linear duty value directly to the LEDC hardware.
  *
+ * @param ch      Pump channel.
  * @param percent Duty as a linear percentage (0–100). Values are scaled
  *                directly: `duty = percent × MAX_DUTY / 100`.
  */
-static void Drip_applyPulse(uint8_t percent)
+static void Drip_applyPulse(MotorChannel& ch, uint8_t percent)
 {
     uint32_t duty = (percent == 0) ? 0 : (uint32_t)(percent * MAX_DUTY / 100UL);
-    ledc_set_duty(LEDC_LOW_SPEED_MODE, MOTOR_PWM_CHANNEL, duty);
-    ledc_update_duty(LEDC_LOW_SPEED_MODE, MOTOR_PWM_CHANNEL);
+    Motor_writeDuty(ch, duty);
+}
+
+/**
+ * @brief Appends a telemetry record for the duty currently applied.
+ *
+ * @param ch         Pump channel.
+ * @param kind       Event kind.
+ * @param onWidthMs  Scheduled ON width of the phase (ms).
+ * @param deadlineUs Scheduled time of this event; lateness is measured
+ *                   against it. NO_DEADLINE for events that start an
+ *                   operation, which are logged as TELEMETRY_LATENESS_NONE.
+ */
+static void Motor_record(const MotorChannel& ch, MotorTelemetryKind kind, uint32_t onWidthMs, int64_t deadlineUs)
+{
+    int32_t latenessUs = (deadlineUs == NO_DEADLINE) ? TELEMETRY_LATENESS_NONE
+                                                     : (int32_t)(nowUs() - deadlineUs);
+    MotorTelemetry_record(ch.index, kind, (uint16_t)ch.appliedDuty, (uint16_t)onWidthMs, latenessUs, ch.source);
 }
 
 /**
- * @brief Timer callback that ends the kickstart phase.
+ * @brief Returns the milliseconds left until `deadlineUs`, or 0 if past.
+ */
+static uint32_t msUntil(int64_t deadlineUs)
+{
+    int64_t left = deadlineUs - nowUs();
+    return (left > 0) ? (uint32_t)(left / 1000) : 0;
+}
+
+/**
+ * @brief Advances a periodic deadline by `periodMs` from its scheduled time.
+ *
+ * If the result already lies in the past (the task was held off for longer
+ * than a period) it is resynchronised to `now` instead, so missed phases are
+ * dropped rather than replayed in a burst.
+ */
+static int64_t advanceDeadline(int64_t deadlineUs, uint32_t periodMs, int64_t now)
+{
+    int64_t next = deadlineUs + (int64_t)periodMs * 1000;
+    return (next > now) ? next : now + (int64_t)periodMs * 1000;
+}
+
+/**
+ * @brief Returns the time left in the cleaning sequence described by `clean`.
+ *
+ * @param clean         Cleaning state (live or frozen).
+ * @param phaseRemainMs Time left in the current ON or OFF phase.
+ */
+static uint32_t cleanRemainingMs(const CleanState& clean, uint32_t phaseRemainMs)
+{
+    const CleanProfile* profile = GET_CLEAN_PROFILE(clean.mode);
+    uint32_t cycleMs = profile->onTimeMs + profile->offTimeMs;
+
+    if (clean.cyclesLeft == 0)
+        return phaseRemainMs;
+
+    // The last cycle ends with its ON phase; its OFF phase is never run.
+    if (clean.isMotorOn)
+        return phaseRemainMs + (clean.cyclesLeft - 1) * cycleMs;
+
+    return phaseRemainMs + clean.cyclesLeft * cycleMs - profile->offTimeMs;
+}
+
+/**
+ * @brief Publishes the channel state as a MotorStatus snapshot.
  *
+ * While paused, the frozen state in `ch.pause` is reported instead of the
+ * (stopped) live state.
+ */
+static void Motor_publishStatus(const MotorChannel& ch)
+{
+    const bool        paused = ch.pause.paused;
+    const CleanState& clean  = paused ? ch.pause.clean : ch.clean;
+    const DripState&  drip   = paused ? ch.pause.drip  : ch.drip;
+    const bool        purge  = paused ? ch.pause.purge : ch.purge.active;
+
+    MotorStatus st = {};
+    st.mode            = MOTOR_MODE_IDLE;
+    st.phase           = MOTOR_PHASE_NONE;
+    st.source          = paused ? ch.pause.source : ch.source;
+    st.paused          = paused;
+    st.duty            = (uint16_t)ch.appliedDuty;
+    st.pulses          = drip.pulses;
+    st.lastPurgeMs     = ch.lastPurge.durationMs;
+    st.lastPurgePrimed = ch.lastPurge.primed;
+
+    if (clean.mode != MOTOR_CMD_STOP)
+    {
+        uint32_t phaseRemainMs = paused ? ch.pause.phaseRemainingMs : msUntil(clean.deadlineUs);
+
+        st.mode        = MOTOR_MODE_CLEANING;
+        st.phase       = clean.isMotorOn ? MOTOR_PHASE_ON : MOTOR_PHASE_OFF;
+        st.cyclesLeft  = clean.cyclesLeft;
+        st.cyclesTotal = GET_CLEAN_PROFILE(clean.mode)->cycles;
+        st.remainingMs = cleanRemainingMs(clean, phaseRemainMs);
+    }
+    else
+    {
+        if (ch.cal.active)
+        {
+            /* Before drip: the drip sweep runs the burst generator. */
+            st.mode        = MOTOR_MODE_CALIBRATING;
+            st.phase       = MOTOR_PHASE_RAMP;
+            st.remainingMs = msUntil(ch.runEndUs);
+        }
+        else if (drip.active)
+        {
+            st.mode       = MOTOR_MODE_DRIP;
+            st.phase      = drip.motorPhase ? MOTOR_PHASE_ON : MOTOR_PHASE_OFF;
+            st.dripPerMin = (uint16_t)(60000UL / drip.periodMs);
+        }
+        else if (purge)
+        {
+            st.mode  = MOTOR_MODE_PURGE;
+            st.phase = ch.purge.rampDone ? MOTOR_PHASE_ON : MOTOR_PHASE_RAMP;
+        }
+        else if (paused ? ch.pause.speed > 0 : ch.running)
+        {
+            st.mode  = MOTOR_MODE_CONTINUOUS;
+            st.phase = MOTOR_PHASE_ON;
+        }
+
+        if (paused && ch.pause.hasTimeout)
+        {
+            st.remainingMs = ch.pause.timeoutRemainingMs;
+        }
+        else if (!paused && ch.runTimed)
+        {
+            st.remainingMs = msUntil(ch.runEndUs);
+        }
+    }
+
+    if (st.mode != MOTOR_MODE_IDLE)
+        st.totalMs = ch.runTotalMs;
+
+    MotorStatus_publish(ch.index, st);
+}
+
+/**
+ * @brief Arms the channel's run timeout to end the operation after `durationMs`.
+ */
+static void armTimeout(MotorChannel& ch, uint32_t durationMs)
+{
+    ch.runTimed = true;
+    ch.runEndUs = nowUs() + (int64_t)durationMs * 1000;
+}
+
+/**
+ * @brief Ends the kickstart phase by dropping to the target duty.
  */
-static void kickstartCallback(TimerHandle_t)
+static void endKickstart(MotorChannel& ch)
 {
-    if (!motorRunning) return;
-    ledc_set_duty(LEDC_LOW_SPEED_MODE, MOTOR_PWM_CHANNEL, kickstartTargetDuty);
-    ledc_update_duty(LEDC_LOW_SPEED_MODE, MOTOR_PWM_CHANNEL);
+    ch.kickstartActive = false;
+
+    if (ch.running)
+        Motor_writeDuty(ch, ch.targetDuty);
 }
 
 /**
- * @brief Sets the motor speed using continuous PWM.
+ * @brief Sets the channel speed using continuous PWM.
  *
  * When starting from rest with a target duty below 50 % of MAX_DUTY, a
  * kickstart pulse at 70 % duty is applied first for KICKSTART_MS milliseconds
- * to overcome static friction. The `kickstartTimer` callback then drops the
- * output to the true target.
+ * to overcome static friction. The scheduler then drops the output to the
+ * true target.
  *
  * Calling with percent ≤ 0 stops the motor immediately, cancels any pending
- * kickstart, and resets `motorRunning`.
+ * kickstart, and resets `ch.running`.
  *
- * @param percent Target speed in the range 0–100 %. Clamped internally.
+ * @param ch         Pump channel.
+ * @param percent    Target speed in the range 0–100 %. Clamped internally.
+ * @param deadlineUs Scheduled time of this speed change, against which a
+ *                   kickstart's lateness is recorded; NO_DEADLINE when it
+ *                   starts an operation.
  */
-static void Motor_setSpeed(int percent)
+static void Motor_setSpeed(MotorChannel& ch, int percent, int64_t deadlineUs = NO_DEADLINE)
 {
     if (percent <= 0)
     {
-        motorRunning = false;
-
-        if (kickstartTimer)
-            xTimerStop(kickstartTimer, 0);
-
-        ledc_set_duty(LEDC_LOW_SPEED_MODE, MOTOR_PWM_CHANNEL, 0);
-        ledc_update_duty(LEDC_LOW_SPEED_MODE, MOTOR_PWM_CHANNEL);
+        ch.running         = false;
+        ch.kickstartActive = false;
+        Motor_writeDuty(ch, 0);
         return;
     }
 
     if (percent > 100)
         percent = 100;
 
-    kickstartTargetDuty = speedToDuty(percent);
+    ch.targetDuty = MotorCal_speedToDuty(ch.index, (uint8_t)percent);
 
-    if (!motorRunning)
+    if (!ch.running)
     {
-        motorRunning = true;
+        ch.running = true;
 
-        if (kickstartTargetDuty < (MAX_DUTY / 2))
+        if (ch.targetDuty < (MAX_DUTY / 2))
         {
-            ledc_set_duty(LEDC_LOW_SPEED_MODE, MOTOR_PWM_CHANNEL, (uint32_t)(0.7f * MAX_DUTY));
-            ledc_update_duty(LEDC_LOW_SPEED_MODE, MOTOR_PWM_CHANNEL);
+            int64_t now = nowUs();
 
-            xTimerStop(kickstartTimer, 0);
-            xTimerStart(kickstartTimer, 0);
+            Motor_writeDuty(ch, (uint32_t)(0.7f * MAX_DUTY));
+            Motor_record(ch, TELEMETRY_KICKSTART, KICKSTART_MS, deadlineUs);
+
+            ch.kickstartActive = true;
+            ch.kickstartEndUs  = now + (int64_t)KICKSTART_MS * 1000;
         }
         else
         {
-            ledc_set_duty(LEDC_LOW_SPEED_MODE, MOTOR_PWM_CHANNEL, kickstartTargetDuty);
-            ledc_update_duty(LEDC_LOW_SPEED_MODE, MOTOR_PWM_CHANNEL);
+            Motor_writeDuty(ch, ch.targetDuty);
         }
     }
-    else
+    else if (!ch.kickstartActive)
     {
-        ledc_set_duty(LEDC_LOW_SPEED_MODE, MOTOR_PWM_CHANNEL, kickstartTargetDuty);
-        ledc_update_duty(LEDC_LOW_SPEED_MODE, MOTOR_PWM_CHANNEL);
+        Motor_writeDuty(ch, ch.targetDuty);
     }
 }
 
 /**
- * @brief Timer callback that alternates the motor between burst ON and OFF phases.
+ * @brief Accounts for a burst that has just started.
  *
- * Each invocation toggles `dripState.motorPhase`:
- *  - ON → OFF: stops the motor, schedules the OFF interval
- *              (`periodMs - pulseMs`, minimum 10 ms).
- *  - OFF → ON: applies the burst pulse, schedules `pulseMs`.
+ * Dosing bursts advance the usage counters and are logged as drip pulses;
+ * characterisation bursts are logged under their own kind and leave the
+ * counters alone.
  */
-static void dripTimerCallback(TimerHandle_t)
+static void recordDripPulse(const MotorChannel& ch, int64_t deadlineUs)
 {
-    if (!dripState.active) return;
-
-    if (dripState.motorPhase)
+    if (ch.drip.dosing)
     {
-        Drip_applyPulse(0);
-        dripState.motorPhase = false;
+        MotorCounters_addPulse();
+        Motor_record(ch, TELEMETRY_DRIP_PULSE, ch.drip.pulseMs, deadlineUs);
+    }
+    else
+    {
+        Motor_record(ch, TELEMETRY_CAL_PULSE, ch.drip.pulseMs, deadlineUs);
+    }
+}
 
-        uint32_t offTimeMs = (dripState.periodMs > dripState.pulseMs) ? (dripState.periodMs - dripState.pulseMs) : 10;
+/**
+ * @brief Alternates the drip generator between burst ON and OFF phases.
+ *
+ *  - ON → OFF: stops the motor; the next burst is due one period after the
+ *              current one was scheduled.
+ *  - OFF → ON: applies the burst pulse for exactly `pulseMs`.
+ */
+static void dripStep(MotorChannel& ch, int64_t now)
+{
+    DripState& drip = ch.drip;
 
-        xTimerChangePeriod(dripTimer, pdMS_TO_TICKS(offTimeMs), 0);
+    if (drip.motorPhase)
+    {
+        Drip_applyPulse(ch, 0);
+        drip.motorPhase = false;
+        drip.deadlineUs = advanceDeadline(drip.periodStartUs, drip.periodMs, now);
     }
     else
     {
-        Drip_applyPulse(dripState.pulseDutyPercent);
-        dripState.motorPhase = true;
+        Drip_applyPulse(ch, drip.pulseDutyPercent);
+        drip.motorPhase = true;
+        recordDripPulse(ch, drip.deadlineUs);
 
-        xTimerChangePeriod(dripTimer, pdMS_TO_TICKS(dripState.pulseMs), 0);
+        drip.periodStartUs = drip.deadlineUs;
+        drip.deadlineUs    = now + (int64_t)drip.pulseMs * 1000;
+        drip.pulses++;
     }
 }
 
 /**
  * @brief Starts the drip burst generator.
  *
- * Applies the first pulse immediately, then hands control to `dripTimer`
- * which alternates ON/OFF phases until stopDripMode() is called.
+ * Applies the first pulse immediately; the scheduler then alternates ON/OFF
+ * phases until stopDripMode() is called.
  *
+ * @param ch               Pump channel.
  * @param periodMs         Full ON+OFF cycle duration in milliseconds.
  * @param pulseDutyPercent Burst amplitude as a linear duty percentage (0–100).
  * @param pulseMs          Burst ON duration in milliseconds.
+ * @param dosing           False for characterisation bursts; see recordDripPulse().
  */
-static void startDripMode(uint32_t periodMs, uint8_t  pulseDutyPercent = DRIP_PULSE_DUTY_DEFAULT, uint32_t pulseMs = DRIP_PULSE_MS_DEFAULT)
+static void startDripMode(MotorChannel& ch, uint32_t periodMs, uint8_t pulseDutyPercent = DRIP_PULSE_DUTY_DEFAULT, uint32_t pulseMs = DRIP_PULSE_MS_DEFAULT,
+                          bool dosing = true)
 {
     if (periodMs < 50) periodMs = 50;
+    if (pulseMs + 10 > periodMs) pulseMs = periodMs - 10;
 
-    dripState.active           = true;
-    dripState.periodMs         = periodMs;
-    dripState.pulseDutyPercent = pulseDutyPercent;
-    dripState.pulseMs          = pulseMs;
-    dripState.motorPhase       = true;
+    int64_t now = nowUs();
 
-    Drip_applyPulse(pulseDutyPercent);
+    ch.drip.active           = true;
+    ch.drip.periodMs         = periodMs;
+    ch.drip.pulseDutyPercent = pulseDutyPercent;
+    ch.drip.pulseMs          = pulseMs;
+    ch.drip.motorPhase       = true;
+    ch.drip.pulses           = 1;
+    ch.drip.dosing           = dosing;
 
-    xTimerChangePeriod(dripTimer, pdMS_TO_TICKS(pulseMs), 0);
+    Drip_applyPulse(ch, pulseDutyPercent);
+    recordDripPulse(ch, NO_DEADLINE);
+
+    ch.drip.periodStartUs = now;
+    ch.drip.deadlineUs    = now + (int64_t)pulseMs * 1000;
 }
 
 /**
  * @brief Stops the drip burst generator and ensures the motor output is zero.
  */
-static void stopDripMode()
+static void stopDripMode(MotorChannel& ch)
 {
-    if (dripState.active)
+    if (ch.drip.active)
     {
-        dripState.active = false;
-        xTimerStop(dripTimer, 0);
-        Drip_applyPulse(0);
+        ch.drip.active = false;
+        Drip_applyPulse(ch, 0);
     }
 }
 
+/**
+ * @brief Ends the running purge and records its outcome.
+ *
+ * Accounts the final run segment in MotorCounters, stores `ch.lastPurge` and
+ * emits a TELEMETRY_PURGE_END record. Does not touch the motor output.
+ *
+ * @param primed True if the purge ended because the line was detected full.
+ */
+static void finishPurge(MotorChannel& ch, bool primed)
+{
+    uint32_t segmentMs = (uint32_t)((nowUs() - ch.purge.segmentStartUs) / 1000);
+
+    ch.purge.active = false;
+    MotorCounters_addPurgeTime(segmentMs);
+
+    ch.lastPurge.durationMs = ch.purge.elapsedMs + segmentMs;
+    ch.lastPurge.primed     = primed;
+
+    uint16_t widthMs = (ch.lastPurge.durationMs > 0xFFFF) ? 0xFFFF : (uint16_t)ch.lastPurge.durationMs;
+    MotorTelemetry_record(ch.index, TELEMETRY_PURGE_END, primed ? 1 : 0, widthMs, TELEMETRY_LATENESS_NONE, ch.source);
+
+    log_i("Channel %u purge finished after %lu ms (%s)", ch.index,
+          (unsigned long)ch.lastPurge.durationMs, primed ? "line primed" : "timeout");
+}
+
 /* =========================
    STOP & NOTIFY
    ========================= */
 
 /**
- * @brief Stops all motor operations and resets all associated state.
+ * @brief Stops all operations on a channel and resets its state.
  *
- * Cancels `motorTimeoutTimer`, `motorCycleTimer`, and the drip generator,
- * then stops the motor and clears the cleaning sequence state.
+ * Cancels the run timeout, the cleaning sequence and the drip generator,
+ * then stops the motor. An active purge is closed out in MotorCounters.
  */
-static void stopAllMotorOperations()
+static void stopAllMotorOperations(MotorChannel& ch)
 {
-    stopDripMode();
+    stopDripMode(ch);
+
+    if (ch.purge.active)
+        finishPurge(ch, false);
+
+    if (ch.cal.active)
+    {
+        ch.cal.active = false;
+        MotorCal_abort(ch.index);
+    }
 
-    xTimerStop(motorTimeoutTimer, 0);
-    xTimerStop(motorCycleTimer, 0);
-    Motor_setSpeed(0);
+    Motor_setSpeed(ch, 0);
 
-    cleanState.mode       = MOTOR_CMD_STOP;
-    cleanState.cyclesLeft = 0;
-    cleanState.isMotorOn  = false;
+    ch.runTimed   = false;
+    ch.runTotalMs = 0;
+
+    ch.clean.mode       = MOTOR_CMD_STOP;
+    ch.clean.cyclesLeft = 0;
+    ch.clean.isMotorOn  = false;
 }
 
 /**
@@ -308,17 +603,17 @@ static void notifyCompletion()
 }
 
 /* =========================
-   TIMER CALLBACKS
+   SCHEDULED EVENTS
    ========================= */
 
 /**
- * @brief Fires when a timed motor operation reaches its duration limit.
+ * @brief Fires when a timed operation reaches its duration limit.
  *
- * Stops all motor operations and notifies completion via the buzzer.
+ * Stops all operations on the channel and notifies completion via the buzzer.
  */
-static void motorTimeoutCallback(TimerHandle_t)
+static void runTimeout(MotorChannel& ch)
 {
-    stopAllMotorOperations();
+    stopAllMotorOperations(ch);
     notifyCompletion();
 }
 
@@ -328,35 +623,42 @@ static void motorTimeoutCallback(TimerHandle_t)
  * Alternates the motor between its ON and OFF phases according to the active
  * CleanProfile.
  */
-static void motorCycleCallback(TimerHandle_t)
+static void cleanStep(MotorChannel& ch, int64_t now)
 {
-    if (cleanState.mode < MOTOR_CMD_CLEAN_FAST || cleanState.mode > MOTOR_CMD_CLEAN_MANUAL)
+    CleanState& clean = ch.clean;
+
+    if (clean.mode < MOTOR_CMD_CLEAN_FAST || clean.mode > MOTOR_CMD_CLEAN_MANUAL)
         return;
 
-    const CleanProfile* profile = GET_CLEAN_PROFILE(cleanState.mode);
+    const CleanProfile* profile = GET_CLEAN_PROFILE(clean.mode);
 
-    if (cleanState.isMotorOn)
+    if (clean.isMotorOn)
     {
-        Motor_setSpeed(0);
-        cleanState.isMotorOn = false;
+        Motor_setSpeed(ch, 0);
+        clean.isMotorOn = false;
+        Motor_record(ch, TELEMETRY_CLEAN_OFF, 0, clean.deadlineUs);
+
+        if (clean.cyclesLeft > 0)
+            clean.cyclesLeft--;
 
-        if (cleanState.cyclesLeft > 0)
-            cleanState.cyclesLeft--;
+        MotorCounters_addCleaningCycle();
 
-        if (cleanState.cyclesLeft == 0)
+        if (clean.cyclesLeft == 0)
         {
-            xTimerStop(motorCycleTimer, 0);
-            cleanState.mode = MOTOR_CMD_STOP;
+            clean.mode    = MOTOR_CMD_STOP;
+            ch.runTotalMs = 0;
             notifyCompletion();
             return;
         }
-        xTimerChangePeriod(motorCycleTimer, pdMS_TO_TICKS(profile->offTimeMs), 0);
+        clean.deadlineUs = now + (int64_t)profile->offTimeMs * 1000;
     }
     else
     {
-        Motor_setSpeed(profile->speed);
-        cleanState.isMotorOn = true;
-        xTimerChangePeriod(motorCycleTimer, pdMS_TO_TICKS(profile->onTimeMs), 0);
+        Motor_setSpeed(ch, profile->speed, clean.deadlineUs);
+        clean.isMotorOn = true;
+        Motor_record(ch, TELEMETRY_CLEAN_ON, profile->onTimeMs, clean.deadlineUs);
+
+        clean.deadlineUs = now + (int64_t)profile->onTimeMs * 1000;
     }
 }
 
@@ -368,13 +670,14 @@ static void motorCycleCallback(TimerHandle_t)
  * @brief Starts a cleaning sequence for the given mode.
  *
  * Looks up the CleanProfile for `mode`, stops any active drip operation,
- * and begins the first ON phase. `motorCycleTimer` then drives subsequent
+ * and begins the first ON phase. The scheduler then drives subsequent
  * ON/OFF transitions until all cycles complete.
  *
+ * @param ch   Pump channel.
  * @param mode One of MOTOR_CMD_CLEAN_FAST, MOTOR_CMD_CLEAN_SLOW, or
  *             MOTOR_CMD_CLEAN_MANUAL.
  */
-static void startCleaningSequence(MotorCmdType mode)
+static void startCleaningSequence(MotorChannel& ch, MotorCmdType mode)
 {
     if (mode < MOTOR_CMD_CLEAN_FAST || mode > MOTOR_CMD_CLEAN_MANUAL)
         return;
@@ -384,56 +687,457 @@ static void startCleaningSequence(MotorCmdType mode)
     if (profile->cycles == 0)
         return;
 
-    stopDripMode();
+    stopDripMode(ch);
+
+    ch.clean.mode       = mode;
+    ch.clean.cyclesLeft = profile->cycles;
+    ch.clean.isMotorOn  = true;
 
-    cleanState.mode       = mode;
-    cleanState.cyclesLeft = profile->cycles;
-    cleanState.isMotorOn  = true;
+    ch.runTotalMs = profile->cycles * (profile->onTimeMs + profile->offTimeMs) - profile->offTimeMs;
 
-    Motor_setSpeed(profile->speed);
+    int64_t now = nowUs();
 
-    xTimerChangePeriod(motorCycleTimer, pdMS_TO_TICKS(profile->onTimeMs), 0);
+    Motor_setSpeed(ch, profile->speed);
+    Motor_record(ch, TELEMETRY_CLEAN_ON, profile->onTimeMs, NO_DEADLINE);
+
+    ch.clean.deadlineUs = now + (int64_t)profile->onTimeMs * 1000;
 }
 
 /**
  * @brief Starts a drip operation for a given speed and duration.
  *
- * Maps `speed` (1–100 %) to the functional hardware range (1–45 %)
- * then converts to a burst period
+ * Maps `speed` (1–100 %) to the functional drip range of the channel
+ * (1–45 % on the reference pump, measured by characterisation when a
+ * drop sensor is fitted) then converts to a burst period.
  *
- * If `durationMs` is non-zero the operation is automatically stopped by
- * `motorTimeoutTimer` after that interval.
+ * If `durationMs` is non-zero the operation is automatically stopped by the
+ * run timeout after that interval.
  *
+ * @param ch         Pump channel.
  * @param speed      Requested speed (0–100 %). 0 stops the motor.
  * @param durationMs Run duration in milliseconds. 0 means indefinite.
  */
-static void startTimedOperation(uint8_t speed, uint32_t durationMs)
+static void startTimedOperation(MotorChannel& ch, uint8_t speed, uint32_t durationMs)
 {
-    stopDripMode();
+    stopDripMode(ch);
 
     if (speed > 0)
     {
-        uint8_t  mapped   = (uint8_t)((speed * 45UL + 99UL) / 100UL);
-        uint32_t periodMs = 10000UL / mapped;
-        startDripMode(periodMs);
+        uint8_t  mapped   = (uint8_t)((speed * (uint32_t)MotorCal_dripRange(ch.index) + 99UL) / 100UL);
+        uint32_t periodMs = CAL_DRIP_PERIOD_MS / mapped;
+        startDripMode(ch, periodMs);
     }
 
+    ch.runTotalMs = durationMs;
+
     if (durationMs > 0)
     {
-        xTimerChangePeriod(motorTimeoutTimer, pdMS_TO_TICKS(durationMs), 0);
+        armTimeout(ch, durationMs);
     }
 }
 
 /**
- * @brief Runs the motor at full speed for PURGE_DURATION_MS milliseconds.
-*/
-static void startPurgeMode()
+ * @brief Starts a purge run segment: first ramp step, detector reset and
+ *        the first purge tick.
+ *
+ * Used both when a purge starts and when it is resumed after a pause; a
+ * resumed purge ramps up again from rest.
+ */
+static void beginPurgeSegment(MotorChannel& ch)
 {
-    stopDripMode();
+    int64_t  now   = nowUs();
+    uint32_t nowMs = millis();
 
-    Motor_setSpeed(100);
+    ch.purge.active         = true;
+    ch.purge.rampDone       = ch.purge.rampMs < PURGE_TICK_MS;
+    ch.purge.segmentStartUs = now;
+    ch.purge.nextTickUs     = now + (int64_t)PURGE_TICK_MS * 1000;
 
-    xTimerChangePeriod(motorTimeoutTimer, pdMS_TO_TICKS(PURGE_DURATION_MS), 0);
+    Motor_setSpeed(ch, ch.purge.rampDone ? ch.purge.speed : PURGE_RAMP_START_PERCENT);
+    PrimeDetector_start(ch.index, nowMs, nowMs + ch.purge.rampMs);
+}
+
+/**
+ * @brief Advances the purge ramp and polls end-of-line detection.
+ *
+ * The ramp holds off while a kickstart boost is in progress so the boost is
+ * not cut short. When the line is confirmed full and the purge was started
+ * with MOTOR_FLAG_STOP_WHEN_PRIMED, the purge ends immediately.
+ */
+static void purgeStep(MotorChannel& ch, int64_t now)
+{
+    PurgeState& purge = ch.purge;
+
+    purge.nextTickUs = advanceDeadline(purge.nextTickUs, PURGE_TICK_MS, now);
+
+    if (!purge.rampDone && !ch.kickstartActive)
+    {
+        uint32_t rampElapsed = (uint32_t)((now - purge.segmentStartUs) / 1000);
+
+        if (rampElapsed >= purge.rampMs)
+        {
+            purge.rampDone = true;
+            Motor_setSpeed(ch, purge.speed);
+        }
+        else
+        {
+            uint32_t span = purge.speed - PURGE_RAMP_START_PERCENT;
+            Motor_setSpeed(ch, PURGE_RAMP_START_PERCENT + (int)(span * rampElapsed / purge.rampMs));
+        }
+    }
+
+    if (purge.stopWhenPrimed && PrimeDetector_update(ch.index, millis()))
+    {
+        finishPurge(ch, true);
+        stopAllMotorOperations(ch);
+        notifyCompletion();
+    }
+}
+
+/**
+ * @brief Starts a purge / priming run.
+ *
+ * Zero fields in `cmd` select the defaults: PURGE_SPEED_DEFAULT,
+ * PURGE_DURATION_MS and PURGE_RAMP_MS_DEFAULT. The run always ends after
+ * `duration` via the run timeout; with MOTOR_FLAG_STOP_WHEN_PRIMED and a
+ * fitted detector it ends as soon as the line is full.
+ *
+ * @param ch  Pump channel.
+ * @param cmd MOTOR_CMD_CLEAN_PURGE command carrying speed, duration, ramp and flags.
+ */
+static void startPurgeMode(MotorChannel& ch, const MotorCommand& cmd)
+{
+    stopDripMode(ch);
+
+    if (ch.purge.active)
+        finishPurge(ch, false);
+
+    ch.purge.speed          = cmd.speed    ? cmd.speed    : PURGE_SPEED_DEFAULT;
+    ch.purge.rampMs         = cmd.rampMs   ? cmd.rampMs   : PURGE_RAMP_MS_DEFAULT;
+    ch.purge.stopWhenPrimed = (cmd.flags & MOTOR_FLAG_STOP_WHEN_PRIMED) && PrimeDetector_available(ch.index);
+    ch.purge.elapsedMs      = 0;
+
+    if (ch.purge.speed < PURGE_RAMP_START_PERCENT)
+        ch.purge.speed = PURGE_RAMP_START_PERCENT;
+
+    beginPurgeSegment(ch);
+
+    uint32_t durationMs = cmd.duration ? cmd.duration : PURGE_DURATION_MS;
+    ch.runTotalMs = durationMs;
+    armTimeout(ch, durationMs);
+}
+
+/**
+ * @brief Starts a characterisation sweep on the channel.
+ *
+ * Refused with an error beep when the channel has neither current sensing
+ * nor a drop sensor. The sweep runs with raw duty values (no kickstart) and
+ * ends on its own; the new curve applies to every later command.
+ */
+static void startCharacterisation(MotorChannel& ch)
+{
+    stopAllMotorOperations(ch);
+
+    if (!MotorCal_available(ch.index))
+    {
+        log_w("Channel %u has no feedback for characterisation", ch.index);
+        sendBuzzerCommand(BUZZER_CMD_ERROR);
+        return;
+    }
+
+    ch.cal.active     = true;
+    ch.cal.nextTickUs = nowUs() + (int64_t)CAL_TICK_MS * 1000;
+    ch.runTotalMs     = MotorCal_durationMs(ch.index);
+    ch.runEndUs       = nowUs() + (int64_t)ch.runTotalMs * 1000; // estimate for the status only
+
+    Motor_writeDuty(ch, MotorCal_begin(ch.index, millis()));
+}
+
+/**
+ * @brief Advances the characterisation sweep by one tick.
+ */
+static void calStep(MotorChannel& ch, int64_t now)
+{
+    ch.cal.nextTickUs = advanceDeadline(ch.cal.nextTickUs, CAL_TICK_MS, now);
+
+    uint16_t       duty         = 0;
+    uint32_t       dripPeriodMs = 0;
+    MotorCalResult result       = MotorCal_update(ch.index, millis(), &duty, &dripPeriodMs);
+
+    if (result == CAL_RUNNING)
+    {
+        if (dripPeriodMs != 0)
+        {
+            /* Drip sweep: the burst generator runs the bursts, the sweep counts the drops. */
+            if (!ch.drip.active || ch.drip.periodMs != dripPeriodMs)
+                startDripMode(ch, dripPeriodMs, DRIP_PULSE_DUTY_DEFAULT, DRIP_PULSE_MS_DEFAULT, false);
+            return;
+        }
+
+        stopDripMode(ch);
+        if (duty != ch.appliedDuty)
+            Motor_writeDuty(ch, duty);
+        return;
+    }
+
+    ch.cal.active = false;
+    stopAllMotorOperations(ch);
+    sendBuzzerCommand(result == CAL_DONE ? BUZZER_CMD_CYCLE_FINISHED : BUZZER_CMD_ERROR);
+}
+
+/**
+ * @brief Returns true when no operation is active on the channel.
+ */
+static bool isChannelIdle(const MotorChannel& ch)
+{
+    return !ch.running && !ch.drip.active && ch.clean.mode == MOTOR_CMD_STOP && !ch.purge.active &&
+           !ch.cal.active;
+}
+
+/**
+ * @brief Returns true when every channel is idle.
+ */
+static bool isMotorIdle()
+{
+    for (const MotorChannel& ch : channels)
+        if (!isChannelIdle(ch))
+            return false;
+
+    return true;
+}
+
+/* =========================
+   PAUSE & RESUME
+   ========================= */
+
+/**
+ * @brief Freezes the running operation, keeping its remaining time, cycle
+ *        index and drip phase in `ch.pause`.
+ *
+ * The motor output is stopped but, unlike MOTOR_CMD_STOP, no progress is
+ * discarded. No-op when idle, already paused or characterising.
+ */
+static void pauseOperation(MotorChannel& ch)
+{
+    PauseState& pause = ch.pause;
+
+    if (pause.paused || isChannelIdle(ch) || ch.cal.active)
+        return;
+
+    pause.source             = ch.source;
+    pause.hasTimeout         = ch.runTimed;
+    pause.timeoutRemainingMs = ch.runTimed ? msUntil(ch.runEndUs) : 0;
+    pause.clean              = ch.clean;
+    pause.drip               = ch.drip;
+    pause.purge              = ch.purge.active;
+    pause.speed              = ch.continuousSpeed;
+    pause.phaseRemainingMs   = 0;
+
+    if (ch.clean.mode != MOTOR_CMD_STOP)
+        pause.phaseRemainingMs = msUntil(ch.clean.deadlineUs);
+    else if (ch.drip.active)
+        pause.phaseRemainingMs = msUntil(ch.drip.deadlineUs);
+
+    stopDripMode(ch);
+    ch.clean.mode = MOTOR_CMD_STOP;
+    ch.runTimed   = false;
+    Motor_setSpeed(ch, 0);
+
+    if (ch.purge.active)
+    {
+        uint32_t segmentMs = (uint32_t)((nowUs() - ch.purge.segmentStartUs) / 1000);
+
+        ch.purge.active     = false;
+        ch.purge.elapsedMs += segmentMs;
+        MotorCounters_addPurgeTime(segmentMs);
+    }
+
+    pause.paused = true;
+}
+
+/**
+ * @brief Restores the operation frozen by pauseOperation().
+ *
+ * The interrupted phase is re-entered with its remaining duration, and the
+ * overall timeout is re-armed with the exact time that was left.
+ */
+static void resumeOperation(MotorChannel& ch)
+{
+    PauseState& pause = ch.pause;
+
+    if (!pause.paused)
+        return;
+
+    pause.paused = false;
+    ch.source    = pause.source;
+
+    uint32_t phaseMs = pause.phaseRemainingMs > 0 ? pause.phaseRemainingMs : 1;
+    int64_t  now     = nowUs();
+
+    if (pause.clean.mode != MOTOR_CMD_STOP)
+    {
+        const CleanProfile* profile = GET_CLEAN_PROFILE(pause.clean.mode);
+
+        ch.clean = pause.clean;
+        Motor_setSpeed(ch, ch.clean.isMotorOn ? profile->speed : 0);
+
+        ch.clean.deadlineUs = now + (int64_t)phaseMs * 1000;
+    }
+    else if (pause.drip.active)
+    {
+        ch.drip = pause.drip;
+        Drip_applyPulse(ch, ch.drip.motorPhase ? ch.drip.pulseDutyPercent : 0);
+
+        ch.drip.deadlineUs = now + (int64_t)phaseMs * 1000;
+
+        // Re-anchor the period grid so the OFF phase keeps its remaining length.
+        if (ch.drip.motorPhase)
+            ch.drip.periodStartUs = ch.drip.deadlineUs - (int64_t)ch.drip.pulseMs * 1000;
+    }
+    else if (pause.purge)
+    {
+        beginPurgeSegment(ch);
+    }
+    else
+    {
+        Motor_setSpeed(ch, pause.speed);
+    }
+
+    if (pause.hasTimeout)
+    {
+        uint32_t timeoutMs = pause.timeoutRemainingMs > 0 ? pause.timeoutRemainingMs : 1;
+        armTimeout(ch, timeoutMs);
+    }
+}
+
+/* =========================
+   SCHEDULER
+   ========================= */
+
+/**
+ * @brief Returns the earliest pending deadline of a channel, or NO_DEADLINE.
+ */
+static int64_t nextDeadline(const MotorChannel& ch)
+{
+    int64_t next = NO_DEADLINE;
+
+    if (ch.kickstartActive && ch.kickstartEndUs < next) next = ch.kickstartEndUs;
+    if (ch.drip.active && ch.drip.deadlineUs < next) next = ch.drip.deadlineUs;
+    if (ch.clean.mode != MOTOR_CMD_STOP && ch.clean.deadlineUs < next) next = ch.clean.deadlineUs;
+    if (ch.purge.active && ch.purge.nextTickUs < next) next = ch.purge.nextTickUs;
+    if (ch.cal.active && ch.cal.nextTickUs < next) next = ch.cal.nextTickUs;
+    if (ch.runTimed && ch.runEndUs < next) next = ch.runEndUs;
+
+    return next;
+}
+
+/**
+ * @brief Runs every event of a channel whose deadline has passed.
+ */
+static void serviceChannel(MotorChannel& ch, int64_t now)
+{
+    if (ch.kickstartActive && now >= ch.kickstartEndUs)
+        endKickstart(ch);
+
+    if (ch.drip.active && now >= ch.drip.deadlineUs)
+        dripStep(ch, now);
+
+    if (ch.clean.mode != MOTOR_CMD_STOP && now >= ch.clean.deadlineUs)
+        cleanStep(ch, now);
+
+    if (ch.purge.active && now >= ch.purge.nextTickUs)
+        purgeStep(ch, now);
+
+    if (ch.cal.active && now >= ch.cal.nextTickUs)
+        calStep(ch, now);
+
+    if (ch.runTimed && now >= ch.runEndUs)
+        runTimeout(ch);
+}
+
+/**
+ * @brief Returns how long TaskMotor may block before the next deadline.
+ *
+ * Capped at COUNTERS_SERVICE_PERIOD_MS so the counter flush policy still
+ * runs while idle.
+ */
+static TickType_t ticksUntilNextDeadline()
+{
+    int64_t next = NO_DEADLINE;
+
+    for (const MotorChannel& ch : channels)
+    {
+        int64_t d = nextDeadline(ch);
+        if (d < next) next = d;
+    }
+
+    int64_t waitUs = next - nowUs();
+
+    if (waitUs <= 0)
+        return 0;
+
+    if (waitUs > (int64_t)COUNTERS_SERVICE_PERIOD_MS * 1000)
+        return pdMS_TO_TICKS(COUNTERS_SERVICE_PERIOD_MS);
+
+    TickType_t ticks = pdMS_TO_TICKS((uint32_t)((waitUs + 999) / 1000));
+    return ticks > 0 ? ticks : 1;
+}
+
+/**
+ * @brief Applies one command to one channel.
+ */
+static void dispatchChannelCommand(MotorChannel& ch, const MotorCommand& cmd)
+{
+    bool sessionCmd = cmd.type != MOTOR_CMD_PAUSE && cmd.type != MOTOR_CMD_RESUME;
+
+    // Any new operation (or STOP) discards a frozen session.
+    if (sessionCmd)
+        ch.pause.paused = false;
+
+    if (sessionCmd && cmd.type != MOTOR_CMD_STOP)
+        ch.source = cmd.type;
+
+    switch (cmd.type)
+    {
+        case MOTOR_CMD_SET_SPEED:
+            stopDripMode(ch);
+            ch.continuousSpeed = cmd.speed;
+            Motor_setSpeed(ch, cmd.speed);
+            break;
+
+        case MOTOR_CMD_START_TIMED:
+            startTimedOperation(ch, cmd.speed, cmd.duration);
+            break;
+
+        case MOTOR_CMD_STOP:
+            stopAllMotorOperations(ch);
+            break;
+
+        case MOTOR_CMD_CLEAN_FAST:
+        case MOTOR_CMD_CLEAN_SLOW:
+        case MOTOR_CMD_CLEAN_MANUAL:
+            startCleaningSequence(ch, cmd.type);
+            break;
+
+        case MOTOR_CMD_CLEAN_PURGE:
+            startPurgeMode(ch, cmd);
+            break;
+
+        case MOTOR_CMD_PAUSE:
+            pauseOperation(ch);
+            break;
+
+        case MOTOR_CMD_RESUME:
+            resumeOperation(ch);
+            break;
+
+        case MOTOR_CMD_CHARACTERISE:
+            startCharacterisation(ch);
+            break;
+
+        default:
+            break;
+    }
 }
 
 void TaskMotor(void* pvParameters)
@@ -442,42 +1146,42 @@ void TaskMotor(void* pvParameters)
 
     for (;;)
     {
-        if (xQueueReceive(xMotorQueue, &cmd, portMAX_DELAY) == pdTRUE)
+        if (xQueueReceive(xMotorQueue, &cmd, ticksUntilNextDeadline()) == pdTRUE)
         {
-            switch (cmd.type)
+            if (cmd.type == MOTOR_CMD_SHUTDOWN)
             {
-                case MOTOR_CMD_SET_SPEED:
-                    stopDripMode();
-                    Motor_setSpeed(cmd.speed);
-                    break;
-
-                case MOTOR_CMD_START_TIMED:
-                    startTimedOperation(cmd.speed, cmd.duration);
-                    break;
-
-                case MOTOR_CMD_STOP:
-                    stopAllMotorOperations();
-                    break;
-
-                case MOTOR_CMD_CLEAN_FAST:
-                case MOTOR_CMD_CLEAN_SLOW:
-                case MOTOR_CMD_CLEAN_MANUAL:
-                    startCleaningSequence(cmd.type);
-                    break;
-
-                case MOTOR_CMD_CLEAN_PURGE:
-                    startPurgeMode();
-                    break;
-
-                default:
-                    break;
+                for (MotorChannel& ch : channels)
+                    stopAllMotorOperations(ch);
+                MotorCounters_flush();
             }
+            else
+            {
+                for (MotorChannel& ch : channels)
+                {
+                    if (cmd.channel == MOTOR_CHANNEL_ALL || cmd.channel == ch.index)
+                        dispatchChannelCommand(ch, cmd);
+                }
+            }
+        }
+
+        int64_t now = nowUs();
+
+        for (MotorChannel& ch : channels)
+        {
+            serviceChannel(ch, now);
+            Motor_publishStatus(ch);
         }
+
+        MotorCounters_service(isMotorIdle());
     }
 }
 
 void TaskMotor_init()
 {
+    MotorCounters_init();
+    PrimeDetector_init();
+    MotorCal_init();
+
     ledc_timer_config_t timer_config = {
         .speed_mode      = LEDC_LOW_SPEED_MODE,
         .duty_resolution = LEDC_TIMER_10_BIT,
@@ -487,61 +1191,36 @@ void TaskMotor_init()
     };
     ESP_ERROR_CHECK(ledc_timer_config(&timer_config));
 
-    ledc_channel_config_t channel_config = {
-        .gpio_num   = PIN_MOTOR,
-        .speed_mode = LEDC_LOW_SPEED_MODE,
-        .channel    = MOTOR_PWM_CHANNEL,
-        .intr_type  = LEDC_INTR_DISABLE,
-        .timer_sel  = MOTOR_PWM_TIMER,
-        .duty       = 0,
-        .hpoint     = 0
-    };
-    ESP_ERROR_CHECK(ledc_channel_config(&channel_config));
-
-    motorTimeoutTimer = xTimerCreate(
-        "MotorTimeout",
-        pdMS_TO_TICKS(1000),
-        pdFALSE,
-        nullptr,
-        motorTimeoutCallback
-    );
-    configASSERT(motorTimeoutTimer);
-
-    motorCycleTimer = xTimerCreate(
-        "MotorCycle",
-        pdMS_TO_TICKS(1000),
-        pdTRUE,
-        nullptr,
-        motorCycleCallback
-    );
-    configASSERT(motorCycleTimer);
-
-    kickstartTimer = xTimerCreate(
-        "Kickstart",
-        pdMS_TO_TICKS(KICKSTART_MS),
-        pdFALSE,
-        nullptr,
-        kickstartCallback
-    );
-    configASSERT(kickstartTimer);
-
-    dripTimer = xTimerCreate(
-        "DripTimer",
-        pdMS_TO_TICKS(100),
-        pdTRUE,
-        nullptr,
-        dripTimerCallback
-    );
-    configASSERT(dripTimer);
+    for (uint8_t i = 0; i < MOTOR_CHANNEL_COUNT; i++)
+    {
+        MotorChannel& ch = channels[i];
+        ch            = {};
+        ch.index      = i;
+        ch.ledc       = MOTOR_PWM_CHANNELS[i];
+        ch.source     = MOTOR_CMD_STOP;
+        ch.clean.mode = MOTOR_CMD_STOP;
+
+        ledc_channel_config_t channel_config = {
+            .gpio_num   = PIN_MOTOR[i],
+            .speed_mode = LEDC_LOW_SPEED_MODE,
+            .channel    = ch.ledc,
+            .intr_type  = LEDC_INTR_DISABLE,
+            .timer_sel  = MOTOR_PWM_TIMER,
+            .duty       = 0,
+            .hpoint     = 0
+        };
+        ESP_ERROR_CHECK(ledc_channel_config(&channel_config));
+    }
 
+    // Above TaskUI and TaskPower: drip pulse edges are timed by this task.
     BaseType_t taskCreated = xTaskCreatePinnedToCore(
         TaskMotor,
         "TaskMotor",
         4096,
         nullptr,
-        1,
+        3,
         nullptr,
         APP_CPU_NUM
     );
     configASSERT(taskCreated == pdPASS);
-}
\ No newline at end of file
+}
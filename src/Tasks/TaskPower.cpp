@@ -3,6 +3,10 @@
  * @brief Power management task implementation.
  */
 #include "Tasks/TaskPower.h"
+#include "UI/Backlight.h"
+
+/** @brief Longest wait for a motor queue slot when powering off. */
+static constexpr uint32_t SHUTDOWN_QUEUE_WAIT_MS = 200;
 
 void TaskPower(void *pvParameters)
 {
@@ -38,9 +42,11 @@ void TaskPower_init()
 
 void Power_requestShutdown()
 {
-    digitalWrite(PIN_TFT_LED, LOW);
-    sendMotorRequest(MOTOR_CMD_SET_SPEED, 0, 0);
-    vTaskDelay(pdMS_TO_TICKS(500));  // allow motor to decelerate before sleep
+    Backlight_off();
+    /* One command, ahead of anything the UI left queued; sleep anyway if the queue stays full. */
+    if (!sendMotorShutdown(SHUTDOWN_QUEUE_WAIT_MS))
+        log_w("Motor queue full; sleeping without flushing the counters");
+    vTaskDelay(pdMS_TO_TICKS(500));  // allow motor to decelerate and counters to reach flash before sleep
 
     // EXT0 wakes on encoder button (active low)
     esp_sleep_enable_ext0_wakeup((gpio_num_t)PIN_SW, 0);
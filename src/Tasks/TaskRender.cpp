@@ -0,0 +1,78 @@
+/**
+ * @file TaskRender.cpp
+ * @brief Display render task implementation.
+ */
+#include "Tasks/TaskRender.h"
+#include "UI/Backlight.h"
+#include "UI/Renderer.h"
+#include "Config/BootProfile.h"
+
+static TaskHandle_t renderTaskHandle = nullptr;
+
+/**
+ * @brief Render task main loop.
+ *
+ * Starts by initialising the TFT, so the display's reset and power-up
+ * delays overlap the rest of setup(), and draws the boot logo as soon as
+ * the panel accepts pixels.
+ *
+ * Sleeps until a frame is requested, or until the screen asks for a
+ * refresh of live values, waits out the rest of the frame period, then
+ * draws. Requests arriving meanwhile only leave the
+ * notification set, so they cost at most one more frame.
+ *
+ * @param pvParameters Unused.
+ */
+void TaskRender(void *pvParameters)
+{
+    UI_init();
+    BootProfile_mark(BOOT_PHASE_TFT_READY);
+
+    if (RENDER_BENCHMARK)
+        UI_benchmarkRender();
+
+    TickType_t lastFrame = xTaskGetTickCount();
+    uint32_t   refreshMs = UI_render();
+
+    /* The boot logo is on screen; light it up. */
+    Backlight_wake();
+    BootProfile_mark(BOOT_PHASE_LOGO);
+
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, refreshMs == UINT32_MAX ? portMAX_DELAY : pdMS_TO_TICKS(refreshMs));
+
+        TickType_t elapsed = xTaskGetTickCount() - lastFrame;
+        if (elapsed < pdMS_TO_TICKS(RENDER_FRAME_PERIOD_MS))
+            vTaskDelay(pdMS_TO_TICKS(RENDER_FRAME_PERIOD_MS) - elapsed);
+
+        /* Requests made during the delay are part of this frame. */
+        ulTaskNotifyTake(pdTRUE, 0);
+
+        lastFrame = xTaskGetTickCount();
+        refreshMs = UI_render();
+    }
+}
+
+/**
+ * @brief Creates the render task.
+ */
+void TaskRender_init()
+{
+    BaseType_t taskCreated = xTaskCreatePinnedToCore(
+        TaskRender,
+        "TaskRender",
+        4096,
+        nullptr,
+        1,
+        &renderTaskHandle,
+        APP_CPU_NUM
+    );
+    configASSERT(taskCreated == pdPASS);
+}
+
+void TaskRender_requestFrame()
+{
+    if (renderTaskHandle)
+        xTaskNotifyGive(renderTaskHandle);
+}
@@ -3,6 +3,7 @@
  * @brief Settings persistence task implementation.
  */
 #include "Tasks/TaskSaveData.h"
+#include "Config/BootProfile.h"
 
 static Preferences prefs;
 
@@ -27,6 +28,7 @@ void TaskSaveData(void *pvParameters)
                     SettingsPayload data;
                     loadSettingsFromStorage(data);
                     UI_applySettings(data);
+                    BootProfile_mark(BOOT_PHASE_SETTINGS);
                     break;
                 }
                 default: break;
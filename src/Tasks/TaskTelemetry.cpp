@@ -0,0 +1,59 @@
+/**
+ * @file TaskTelemetry.cpp
+ * @brief Motor telemetry streaming task implementation.
+ */
+#include "Tasks/TaskTelemetry.h"
+
+/** @brief Frame sync word preceding every record on the wire. */
+static const uint8_t TELEMETRY_SYNC[2] = { 0xA5, 0x5A };
+
+/** @brief Records copied out of the ring buffer per drain pass. */
+static constexpr uint32_t TELEMETRY_BATCH = 16;
+
+/** @brief Bytes per streamed frame. */
+static constexpr int TELEMETRY_FRAME_SIZE = sizeof(TELEMETRY_SYNC) + sizeof(MotorTelemetryRecord);
+
+void TaskTelemetry(void *pvParameters)
+{
+    MotorTelemetryRecord batch[TELEMETRY_BATCH];
+
+    for(;;)
+    {
+        vTaskDelay(pdMS_TO_TICKS(TELEMETRY_DRAIN_PERIOD_MS));
+
+        // Without a host, drain and discard so stale records do not fill the buffer.
+        if (!Serial)
+        {
+            while (MotorTelemetry_read(batch, TELEMETRY_BATCH) > 0) {}
+            continue;
+        }
+
+        // Only take what the CDC buffer can accept right now, so writes never stall.
+        uint32_t room = (uint32_t)Serial.availableForWrite() / TELEMETRY_FRAME_SIZE;
+        if (room > TELEMETRY_BATCH) room = TELEMETRY_BATCH;
+
+        uint32_t count = MotorTelemetry_read(batch, room);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            Serial.write(TELEMETRY_SYNC, sizeof(TELEMETRY_SYNC));
+            Serial.write((const uint8_t*)&batch[i], sizeof(MotorTelemetryRecord));
+        }
+    }
+}
+
+void TaskTelemetry_init()
+{
+    Serial.setTxTimeoutMs(0);
+    Serial.begin();
+
+    BaseType_t taskCreated = xTaskCreatePinnedToCore(
+        TaskTelemetry,
+        "TaskTelemetry",
+        3072,
+        NULL,
+        1,
+        NULL,
+        APP_CPU_NUM
+    );
+    configASSERT(taskCreated == pdPASS);
+}
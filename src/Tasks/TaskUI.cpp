@@ -4,42 +4,56 @@
  */
 
 #include "Tasks/TaskUI.h"
+#include "Input/InputRing.h"
+#include "UI/Backlight.h"
 
 /**
  * @brief UI task main loop.
  *
- * Blocks on xUIQueue waiting for EncoderEvent messages and
- * dispatches them to the UI FSM.
+ * Drains every buffered InputEvent into the UI FSM, then sleeps on the
+ * task notification given by InputRing_push(), or until the backlight's
+ * next idle step, or until Backlight_wake() turns the light on. An event
+ * that wakes the backlight is not dispatched.
+ * Nothing is drawn here; TaskRender picks up the model changes.
  *
  * @param pvParameters Unused.
  */
 void TaskUI(void *pvParameters)
 {   
-    EncoderEvent evt;
+    InputEvent evt;
     for (;;)
     {
-        if (xQueueReceive(xUIQueue, &evt, portMAX_DELAY) == pdTRUE)
+        while (InputRing_pop(&evt))
         {
-            UI_processEvent(evt);
+            if (!Backlight_onInput(evt))
+                UI_processEvent(evt);
         }
+
+        uint32_t idleStepMs = Backlight_tick(millis());
+        ulTaskNotifyTake(pdTRUE, idleStepMs == UINT32_MAX ? portMAX_DELAY : pdMS_TO_TICKS(idleStepMs));
     }
 }
 
 /**
- * @brief Initializes UI subsystem and creates UI task.
+ * @brief Initializes the UI model and creates UI task.
+ *
+ * The display itself is brought up by TaskRender.
  */
 void TaskUI_init()
 {
-    UI_init();
+    UI_initState();
     UI_setState(MENU_INIT); /* Force initial state BEFORE task starts processing events */
+    TaskHandle_t uiTaskHandle = nullptr;
     BaseType_t taskCreated = xTaskCreatePinnedToCore(
         TaskUI,
         "TaskUI",
         4096,
         nullptr,
-        1,
-        nullptr,
+        2,  /* above TaskRender, so input never waits for the display */
+        &uiTaskHandle,
         APP_CPU_NUM
     );
     configASSERT(taskCreated == pdPASS);
+    InputRing_setConsumer(uiTaskHandle);
+    Backlight_setTimerTask(uiTaskHandle);
 }
\ No newline at end of file
@@ -0,0 +1,176 @@
+/**
+ * @file Backlight.cpp
+ * @brief PWM backlight implementation.
+ *
+ * State is shared between TaskUI (input, timeouts), TaskRender (first
+ * frame) and TaskPower (shutdown), so it is guarded by `stateLock`. The
+ * LEDC calls are made outside the lock.
+ *
+ * Off uses `ledc_stop()` so the pin is driven low rather than left at a
+ * zero-duty PWM, as in the buzzer driver.
+ */
+#include "UI/Backlight.h"
+#include "Config/pins.h"
+#include <Arduino.h>
+
+static portMUX_TYPE stateLock = portMUX_INITIALIZER_UNLOCKED;
+
+static BacklightLevel level          = BACKLIGHT_OFF;
+static uint32_t       lastActivityMs = 0;
+
+/** @brief Timestamp of the event that woke the screen. */
+static uint32_t wakeEventMs     = 0;
+
+/** @brief Press start of the button event that woke the screen; its repeats are consumed too. */
+static uint32_t wakePressMs     = 0;
+static bool     wakeByButton    = false;
+
+/** @brief Task running Backlight_tick(); set once before the tasks start. */
+static TaskHandle_t timerTask   = nullptr;
+
+static void applyLevel(BacklightLevel newLevel)
+{
+    if (newLevel == BACKLIGHT_OFF)
+    {
+        ledc_stop(LEDC_LOW_SPEED_MODE, BACKLIGHT_PWM_CHANNEL, 0);
+        return;
+    }
+
+    const uint32_t maxDuty = (1UL << BACKLIGHT_RESOLUTION) - 1;
+    const uint8_t  percent = (newLevel == BACKLIGHT_FULL) ? BACKLIGHT_FULL_PERCENT : BACKLIGHT_DIM_PERCENT;
+
+    ledc_set_duty(LEDC_LOW_SPEED_MODE, BACKLIGHT_PWM_CHANNEL, maxDuty * percent / 100);
+    ledc_update_duty(LEDC_LOW_SPEED_MODE, BACKLIGHT_PWM_CHANNEL);
+}
+
+/**
+ * @brief Moves to `newLevel`; returns the previous level.
+ */
+static BacklightLevel setLevel(BacklightLevel newLevel)
+{
+    portENTER_CRITICAL(&stateLock);
+    BacklightLevel old = level;
+    level = newLevel;
+    portEXIT_CRITICAL(&stateLock);
+
+    if (old != newLevel)
+        applyLevel(newLevel);
+    return old;
+}
+
+void Backlight_init()
+{
+    ledc_timer_config_t timer_config = {
+        .speed_mode      = LEDC_LOW_SPEED_MODE,
+        .duty_resolution = BACKLIGHT_RESOLUTION,
+        .timer_num       = BACKLIGHT_PWM_TIMER,
+        .freq_hz         = BACKLIGHT_PWM_FREQ_HZ,
+        .clk_cfg         = LEDC_AUTO_CLK
+    };
+    ESP_ERROR_CHECK(ledc_timer_config(&timer_config));
+
+    ledc_channel_config_t channel_config = {
+        .gpio_num   = PIN_TFT_LED,
+        .speed_mode = LEDC_LOW_SPEED_MODE,
+        .channel    = BACKLIGHT_PWM_CHANNEL,
+        .intr_type  = LEDC_INTR_DISABLE,
+        .timer_sel  = BACKLIGHT_PWM_TIMER,
+        .duty       = 0,
+        .hpoint     = 0
+    };
+    ESP_ERROR_CHECK(ledc_channel_config(&channel_config));
+
+    level = BACKLIGHT_OFF;
+}
+
+void Backlight_setTimerTask(TaskHandle_t task)
+{
+    timerTask = task;
+}
+
+void Backlight_wake()
+{
+    portENTER_CRITICAL(&stateLock);
+    lastActivityMs = millis();
+    portEXIT_CRITICAL(&stateLock);
+
+    setLevel(BACKLIGHT_FULL);
+
+    /* The timer task saw the light off and is waiting with no deadline. */
+    if (timerTask)
+        xTaskNotifyGive(timerTask);
+}
+
+void Backlight_off()
+{
+    setLevel(BACKLIGHT_OFF);
+}
+
+BacklightLevel Backlight_level()
+{
+    portENTER_CRITICAL(&stateLock);
+    BacklightLevel current = level;
+    portEXIT_CRITICAL(&stateLock);
+    return current;
+}
+
+bool Backlight_onInput(const InputEvent& evt)
+{
+    const bool isButton = (evt.type == BTN_SHORT || evt.type == BTN_LONG ||
+                           evt.type == BTN_DOUBLE || evt.type == BTN_REPEAT);
+    const uint32_t pressStartMs = evt.timestampMs - evt.pressMs;
+
+    portENTER_CRITICAL(&stateLock);
+    lastActivityMs = millis();
+    const bool asleep = (level != BACKLIGHT_FULL);
+
+    bool consumed;
+    if (asleep)
+    {
+        wakeEventMs  = evt.timestampMs;
+        wakeByButton = isButton;
+        wakePressMs  = pressStartMs;
+        consumed     = true;
+    }
+    else if (isButton)
+    {
+        /* Hold and repeats of the press that woke the screen. */
+        consumed = wakeByButton && pressStartMs == wakePressMs;
+    }
+    else
+    {
+        consumed = (evt.timestampMs - wakeEventMs) < BACKLIGHT_WAKE_GUARD_MS;
+    }
+    portEXIT_CRITICAL(&stateLock);
+
+    if (asleep)
+        setLevel(BACKLIGHT_FULL);
+
+    return consumed;
+}
+
+uint32_t Backlight_tick(uint32_t nowMs)
+{
+    portENTER_CRITICAL(&stateLock);
+    const uint32_t idleMs  = nowMs - lastActivityMs;
+    const BacklightLevel current = level;
+    portEXIT_CRITICAL(&stateLock);
+
+    if (current == BACKLIGHT_OFF)
+        return UINT32_MAX;
+
+    if (idleMs >= BACKLIGHT_OFF_AFTER_MS)
+    {
+        setLevel(BACKLIGHT_OFF);
+        return UINT32_MAX;
+    }
+
+    if (idleMs >= BACKLIGHT_DIM_AFTER_MS)
+    {
+        if (current == BACKLIGHT_FULL)
+            setLevel(BACKLIGHT_DIM);
+        return BACKLIGHT_OFF_AFTER_MS - idleMs;
+    }
+
+    return BACKLIGHT_DIM_AFTER_MS - idleMs;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file DisplayMem.cpp
+ * @brief Display buffer accounting implementation.
+ *
+ * Only the render task allocates display buffers, so the counters need no
+ * lock.
+ */
+#include "UI/DisplayMem.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+
+static size_t inUse = 0;
+static size_t peak  = 0;
+
+bool DisplayMem_canAllocate(size_t bytes)
+{
+    size_t freeBytes = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    return freeBytes >= bytes + DISPLAY_MEM_MIN_FREE &&
+           heap_caps_get_largest_free_block(MALLOC_CAP_8BIT) >= bytes;
+}
+
+void DisplayMem_account(int32_t bytes)
+{
+    inUse += bytes;
+
+    if (inUse > peak)
+    {
+        peak = inUse;
+        log_i("Display memory peak %u bytes", (unsigned)peak);
+    }
+}
+
+void* DisplayMem_alloc(size_t bytes)
+{
+    if (!DisplayMem_canAllocate(bytes))
+        return nullptr;
+
+    void* buffer = heap_caps_malloc(bytes, MALLOC_CAP_8BIT);
+    if (buffer)
+        DisplayMem_account((int32_t)bytes);
+    return buffer;
+}
+
+void DisplayMem_free(void* buffer, size_t bytes)
+{
+    if (!buffer)
+        return;
+
+    heap_caps_free(buffer);
+    DisplayMem_account(-(int32_t)bytes);
+}
+
+size_t DisplayMem_inUse()
+{
+    return inUse;
+}
+
+size_t DisplayMem_peak()
+{
+    return peak;
+}
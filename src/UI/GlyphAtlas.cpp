@@ -0,0 +1,266 @@
+/**
+ * @file GlyphAtlas.cpp
+ * @brief Glyph atlas implementation.
+ *
+ * Each glyph is drawn by TFT_eSPI itself into a scratch sprite, so the
+ * tiles are pixel-identical to what drawString() produces, and the ink
+ * bounds are found by scanning the sprite rather than decoding the font.
+ */
+#include "UI/GlyphAtlas.h"
+#include "UI/DisplayMem.h"
+#include <freertos/FreeRTOS.h>
+#include <string.h>
+
+static size_t tileStride(const AtlasGlyph* g)
+{
+    return (g->w + 7) / 8;
+}
+
+static size_t tileBytes(const AtlasGlyph* g)
+{
+    return tileStride(g) * g->h;
+}
+
+static const AtlasGlyph* findGlyph(const GlyphAtlas* atlas, char c)
+{
+    for (uint8_t i = 0; i < atlas->count; i++)
+    {
+        if (atlas->glyphs[i].code == c)
+            return &atlas->glyphs[i];
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Renders one glyph into `scratch` and stores its inked area as a tile.
+ *
+ * @return False if the tile could not be allocated.
+ */
+static bool renderGlyph(AtlasGlyph* g, TFT_eSprite& scratch, int16_t originX, char c)
+{
+    const char one[2] = { c, '\0' };
+    const char two[3] = { c, c, '\0' };
+
+    g->code      = c;
+    g->lastWidth = scratch.textWidth(one);
+    g->advance   = scratch.textWidth(two) - g->lastWidth;
+
+    const int16_t sw = scratch.width();
+    const int16_t sh = scratch.height();
+
+    scratch.fillSprite(TFT_BLACK);
+    scratch.drawString(one, originX, sh / 2);
+
+    const uint16_t* src = (const uint16_t*)scratch.getPointer();
+    int16_t x0 = sw, y0 = sh, x1 = -1, y1 = -1;
+    for (int16_t y = 0; y < sh; y++)
+    {
+        for (int16_t x = 0; x < sw; x++)
+        {
+            if (src[y * sw + x] == TFT_BLACK) continue;
+            if (x < x0) x0 = x;
+            if (x > x1) x1 = x;
+            if (y < y0) y0 = y;
+            if (y > y1) y1 = y;
+        }
+    }
+
+    if (x1 < 0)
+    {
+        /* No ink, e.g. a space: only the advance matters. */
+        g->dx = g->dy = 0;
+        g->w  = g->h  = 0;
+        g->bits = nullptr;
+        return true;
+    }
+
+    g->dx = x0 - originX;
+    g->dy = y0 - sh / 2;
+    g->w  = x1 - x0 + 1;
+    g->h  = y1 - y0 + 1;
+
+    g->bits = (uint8_t*)DisplayMem_alloc(tileBytes(g));
+    if (!g->bits)
+        return false;
+
+    const size_t stride = tileStride(g);
+    memset(g->bits, 0, tileBytes(g));
+    for (uint16_t row = 0; row < g->h; row++)
+    {
+        const uint16_t* line = &src[(y0 + row) * sw + x0];
+        for (uint16_t col = 0; col < g->w; col++)
+        {
+            if (line[col] != TFT_BLACK)
+                g->bits[row * stride + col / 8] |= 0x80 >> (col % 8);
+        }
+    }
+    return true;
+}
+
+bool GlyphAtlas_build(GlyphAtlas* atlas, TFT_eSPI* tft, const GFXfont* font, uint8_t textSize,
+                      uint16_t color, const char* const* texts, uint8_t count)
+{
+    atlas->ready = false;
+    atlas->count = 0;
+
+    TFT_eSprite scratch = TFT_eSprite(tft);
+    scratch.setColorDepth(16);
+    scratch.setTextSize(textSize);
+    scratch.setFreeFont(font);
+    scratch.setTextColor(color);
+    scratch.setTextDatum(ML_DATUM);
+
+    atlas->height = scratch.fontHeight();
+    atlas->color  = (color >> 8) | (color << 8);
+
+    /* Room for the widest glyph plus overhang on either side. */
+    const int16_t originX      = atlas->height / 2;
+    const size_t  scratchBytes = (size_t)atlas->height * 2 * atlas->height * sizeof(uint16_t);
+
+    if (!DisplayMem_canAllocate(scratchBytes) || !scratch.createSprite(atlas->height * 2, atlas->height))
+        return false;
+    DisplayMem_account((int32_t)scratchBytes);
+
+    bool ok = true;
+    for (uint8_t t = 0; t < count && ok; t++)
+    {
+        for (const char* p = texts[t]; *p && ok; p++)
+        {
+            if (findGlyph(atlas, *p))
+                continue;
+
+            configASSERT(atlas->count < GLYPH_ATLAS_MAX_GLYPHS);
+            AtlasGlyph* g = &atlas->glyphs[atlas->count++];
+            ok = renderGlyph(g, scratch, originX, *p);
+            if (!ok)
+                atlas->count--;
+        }
+    }
+
+    scratch.deleteSprite();
+    DisplayMem_account(-(int32_t)scratchBytes);
+
+    if (!ok)
+    {
+        GlyphAtlas_release(atlas);
+        return false;
+    }
+
+    atlas->ready = true;
+    return true;
+}
+
+void GlyphAtlas_release(GlyphAtlas* atlas)
+{
+    for (uint8_t i = 0; i < atlas->count; i++)
+    {
+        AtlasGlyph* g = &atlas->glyphs[i];
+        DisplayMem_free(g->bits, tileBytes(g));
+        g->bits = nullptr;
+    }
+
+    atlas->count = 0;
+    atlas->ready = false;
+}
+
+int16_t GlyphAtlas_textWidth(const GlyphAtlas* atlas, const char* text, size_t len)
+{
+    int16_t width = 0;
+
+    for (size_t i = 0; i < len && text[i]; i++)
+    {
+        const AtlasGlyph* g = findGlyph(atlas, text[i]);
+        if (!g) continue;
+
+        /* textWidth() counts the ink of the last character instead of its advance. */
+        bool last = (i + 1 == len) || text[i + 1] == '\0';
+        width += last ? g->lastWidth : g->advance;
+    }
+    return width;
+}
+
+/** @brief Clipped placement of a tile in a sprite. */
+struct TileClip
+{
+    int16_t c0, c1; ///< Tile columns to copy.
+    int16_t r0, r1; ///< Tile rows to copy.
+};
+
+static TileClip clipTile(const AtlasGlyph* g, int16_t dstW, int16_t dstH, int16_t x, int16_t y)
+{
+    return TileClip{ (int16_t)(x < 0 ? -x : 0),
+                     (int16_t)((x + g->w > dstW) ? dstW - x : g->w),
+                     (int16_t)(y < 0 ? -y : 0),
+                     (int16_t)((y + g->h > dstH) ? dstH - y : g->h) };
+}
+
+static inline bool tileInk(const AtlasGlyph* g, int16_t r, int16_t c)
+{
+    return g->bits[r * tileStride(g) + c / 8] & (0x80 >> (c % 8));
+}
+
+/**
+ * @brief Writes the ink of one tile into a 16-bit sprite, clipped to it.
+ */
+static void blitGlyph16(const AtlasGlyph* g, uint16_t color, uint16_t* dst, int16_t dstW, int16_t dstH,
+                        int16_t x, int16_t y)
+{
+    const TileClip clip = clipTile(g, dstW, dstH, x, y);
+
+    for (int16_t r = clip.r0; r < clip.r1; r++)
+    {
+        uint16_t* out = &dst[(y + r) * dstW + x];
+        for (int16_t c = clip.c0; c < clip.c1; c++)
+        {
+            if (tileInk(g, r, c))
+                out[c] = color;
+        }
+    }
+}
+
+/**
+ * @brief Sets the ink bits of one tile in a 1-bit sprite, clipped to it.
+ *
+ * 1-bit sprite rows are padded to whole bytes, MSB first, like the tiles.
+ */
+static void blitGlyph1(const AtlasGlyph* g, uint8_t* dst, int16_t dstW, int16_t dstH, int16_t x, int16_t y)
+{
+    const TileClip clip   = clipTile(g, dstW, dstH, x, y);
+    const size_t   stride = (dstW + 7) / 8;
+
+    for (int16_t r = clip.r0; r < clip.r1; r++)
+    {
+        uint8_t* out = &dst[(y + r) * stride];
+        for (int16_t c = clip.c0; c < clip.c1; c++)
+        {
+            if (tileInk(g, r, c))
+                out[(x + c) / 8] |= 0x80 >> ((x + c) % 8);
+        }
+    }
+}
+
+void GlyphAtlas_draw(const GlyphAtlas* atlas, TFT_eSprite& dst, const char* text, int16_t x, int16_t midY)
+{
+    const bool    mono   = (dst.getColorDepth() == 1);
+    void*         pixels = dst.getPointer();
+    const int16_t dstW   = dst.width();
+    const int16_t dstH   = dst.height();
+
+    configASSERT(mono || dst.getColorDepth() == 16);
+
+    for (const char* p = text; *p; p++)
+    {
+        const AtlasGlyph* g = findGlyph(atlas, *p);
+        if (!g) continue;
+
+        if (g->bits)
+        {
+            if (mono)
+                blitGlyph1(g, (uint8_t*)pixels, dstW, dstH, x + g->dx, midY + g->dy);
+            else
+                blitGlyph16(g, atlas->color, (uint16_t*)pixels, dstW, dstH, x + g->dx, midY + g->dy);
+        }
+
+        x += g->advance;
+    }
+}
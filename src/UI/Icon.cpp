@@ -0,0 +1,179 @@
+/**
+ * @file Icon.cpp
+ * @brief Packed icon decoder implementation.
+ */
+#include "UI/Icon.h"
+#include <pgmspace.h>
+#include <freertos/FreeRTOS.h>
+#include <string.h>
+
+void IconDecoder_init(IconDecoder* dec, const PackedIcon* icon)
+{
+    dec->icon    = icon;
+    dec->pos     = 0;
+    dec->color   = 0;
+    dec->index   = 0;
+    dec->runLeft = 0;
+}
+
+/**
+ * @brief Loads the next run into the decoder. RAW and PALETTE runs are one pixel.
+ */
+static void loadRun(IconDecoder* dec)
+{
+    const PackedIcon* icon = dec->icon;
+
+    switch (icon->encoding)
+    {
+        case ICON_ENCODING_RAW:
+        {
+            const uint8_t* p = &icon->data[dec->pos * 2];
+            dec->color   = pgm_read_byte(p) | (pgm_read_byte(p + 1) << 8);
+            dec->runLeft = 1;
+            dec->pos++;
+            break;
+        }
+        case ICON_ENCODING_PALETTE:
+        {
+            /* `pos` counts pixels; indices never straddle a byte. */
+            uint32_t bit   = dec->pos * icon->indexBits;
+            uint8_t  b     = pgm_read_byte(&icon->data[bit / 8]);
+            uint8_t  shift = 8 - icon->indexBits - (bit % 8);
+            uint8_t  index = (b >> shift) & ((1u << icon->indexBits) - 1);
+
+            dec->color   = pgm_read_word(&icon->palette[index]);
+            dec->index   = index;
+            dec->runLeft = 1;
+            dec->pos++;
+            break;
+        }
+        case ICON_ENCODING_RLE:
+        {
+            const uint8_t runBits = 8 - icon->indexBits;
+
+            uint8_t  b   = pgm_read_byte(&icon->data[dec->pos++]);
+            uint16_t run = b & ((1u << runBits) - 1);
+            if (run == 0)
+                run = (1u << runBits) + pgm_read_byte(&icon->data[dec->pos++]);
+
+            dec->index   = b >> runBits;
+            dec->color   = pgm_read_word(&icon->palette[dec->index]);
+            dec->runLeft = run;
+            break;
+        }
+    }
+}
+
+uint16_t IconDecoder_next(IconDecoder* dec, uint16_t limit, uint16_t* color)
+{
+    if (dec->runLeft == 0)
+        loadRun(dec);
+
+    uint16_t n = dec->runLeft < limit ? dec->runLeft : limit;
+    dec->runLeft -= n;
+    *color = dec->color;
+    return n;
+}
+
+void Icon_drawToSprite(const PackedIcon* icon, TFT_eSprite& dst, int16_t x, int16_t y, uint16_t transparent)
+{
+    uint16_t* pixels = (uint16_t*)dst.getPointer();
+    const int16_t dstW = dst.width();
+    const int16_t dstH = dst.height();
+
+    IconDecoder dec;
+    IconDecoder_init(&dec, icon);
+
+    for (int16_t row = 0; row < icon->height; row++)
+    {
+        const int16_t py = y + row;
+        const bool rowVisible = py >= 0 && py < dstH;
+
+        for (int16_t col = 0; col < icon->width; )
+        {
+            uint16_t color;
+            uint16_t n = IconDecoder_next(&dec, icon->width - col, &color);
+
+            if (rowVisible && color != transparent)
+            {
+                int16_t x0 = x + col;
+                int16_t x1 = x0 + n;
+                if (x0 < 0)    x0 = 0;
+                if (x1 > dstW) x1 = dstW;
+
+                /* Sprites keep pixels byte-swapped. */
+                uint16_t swapped = (color >> 8) | (color << 8);
+                uint16_t* out = &pixels[py * dstW];
+                for (int16_t px = x0; px < x1; px++)
+                    out[px] = swapped;
+            }
+            col += n;
+        }
+    }
+}
+
+void Icon_drawIndexed(const PackedIcon* icon, TFT_eSprite& dst, int16_t x, int16_t y,
+                      uint16_t transparent, uint8_t firstIndex)
+{
+    configASSERT(icon->encoding != ICON_ENCODING_RAW);
+
+    uint8_t* pixels = (uint8_t*)dst.getPointer();
+    const int16_t dstW = dst.width();
+    const int16_t dstH = dst.height();
+
+    IconDecoder dec;
+    IconDecoder_init(&dec, icon);
+
+    for (int16_t row = 0; row < icon->height; row++)
+    {
+        const int16_t py = y + row;
+        const bool rowVisible = py >= 0 && py < dstH;
+
+        for (int16_t col = 0; col < icon->width; )
+        {
+            uint16_t color;
+            uint16_t n = IconDecoder_next(&dec, icon->width - col, &color);
+
+            if (rowVisible && color != transparent)
+            {
+                int16_t x0 = x + col;
+                int16_t x1 = x0 + n;
+                if (x0 < 0)    x0 = 0;
+                if (x1 > dstW) x1 = dstW;
+
+                if (x1 > x0)
+                    memset(&pixels[py * dstW + x0], firstIndex + dec.index, x1 - x0);
+            }
+            col += n;
+        }
+    }
+}
+
+void Icon_push(TFT_eSPI& tft, int16_t x, int16_t y, const PackedIcon* icon,
+               uint16_t transparent, uint16_t background)
+{
+    configASSERT(icon->width <= ICON_MAX_WIDTH);
+
+    uint16_t line[ICON_MAX_WIDTH];
+
+    IconDecoder dec;
+    IconDecoder_init(&dec, icon);
+
+    tft.startWrite();
+    tft.setAddrWindow(x, y, icon->width, icon->height);
+
+    for (uint16_t row = 0; row < icon->height; row++)
+    {
+        for (uint16_t col = 0; col < icon->width; )
+        {
+            uint16_t color;
+            uint16_t n = IconDecoder_next(&dec, icon->width - col, &color);
+            if (color == transparent) color = background;
+
+            while (n--) line[col++] = color;
+        }
+        tft.pushPixels(line, icon->width);
+    }
+
+    tft.endWrite();
+}
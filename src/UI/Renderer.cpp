@@ -0,0 +1,329 @@
+/**
+ * @file Renderer.cpp
+ * @brief Dirty-rectangle renderer implementation.
+ *
+ * TFT_eSPI requires chip select to stay asserted for the whole DMA
+ * transfer, so the renderer opens a write transaction on the first push
+ * and keeps it open until Renderer_sync().
+ *
+ * Each band gets a canvas of exactly its size so its pixels are contiguous
+ * for `pushImageDMA()`. `pushImageDMA()` waits for the previous transfer
+ * before starting, so by the time a canvas is reallocated its own
+ * transfer has always completed.
+ *
+ * Canvas memory is reported to DisplayMem. When the heap is short, bands
+ * get fewer rows instead of failing, down to a single line.
+ *
+ * While capturing, bands are copied into the capture frame; both are in
+ * panel byte order. Paletted bands are expanded straight into the frame.
+ *
+ * Paletted bands are sent from the two line buffers in turn, by the same
+ * rule: when a chunk is started the transfer before it has completed, so
+ * the buffer about to be refilled is free. The line buffers live as long
+ * as the renderer.
+ */
+#include "UI/Renderer.h"
+#include "UI/DisplayMem.h"
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <string.h>
+
+static TFT_eSPI* display = nullptr;
+
+static TFT_eSprite* canvases[2]     = { nullptr, nullptr };
+static size_t       canvasBytes[2]  = { 0, 0 };
+static uint8_t      nextCanvas      = 0;
+
+static Rect    dirty[RENDER_MAX_DIRTY];
+static uint8_t dirtyCount = 0;
+
+static TFT_eSprite* captureFrame = nullptr;
+
+static bool     writeOpen      = false;
+static uint32_t lastFlushBytes = 0;
+
+/** @brief Largest canvasBytes[0] + canvasBytes[1] during the current flush. */
+static size_t   flushCanvasPeak = 0;
+
+static RenderFormat canvasFormat = RENDER_RGB565;
+
+/** @brief Palette of the current flush in panel byte order. */
+static uint16_t panelPalette[256];
+
+static uint16_t* lineBuffers[2]  = { nullptr, nullptr };
+static size_t    lineBufferBytes = 0;
+static uint8_t   nextLineBuffer  = 0;
+
+static uint8_t formatDepth(RenderFormat f)
+{
+    return (f == RENDER_MONO1) ? 1 : (f == RENDER_INDEXED8) ? 8 : 16;
+}
+
+/**
+ * @brief Returns the canvas size of a `w` x `h` band in the current format.
+ *
+ * 1-bit sprite rows are padded to whole bytes.
+ */
+static size_t bandBytes(int16_t w, int16_t h)
+{
+    switch (canvasFormat)
+    {
+        case RENDER_MONO1:    return (size_t)((w + 7) / 8) * h;
+        case RENDER_INDEXED8: return (size_t)w * h;
+        default:              return (size_t)w * h * sizeof(uint16_t);
+    }
+}
+
+void Renderer_init(TFT_eSPI* tft)
+{
+    display = tft;
+    display->initDMA();
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        canvases[i] = new TFT_eSprite(display);
+        canvases[i]->setColorDepth(16);
+        canvases[i]->setSwapBytes(true);
+    }
+
+    lineBufferBytes = (size_t)display->width() * RENDER_EXPAND_LINES * sizeof(uint16_t);
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        lineBuffers[i] = (uint16_t*)DisplayMem_alloc(lineBufferBytes);
+        configASSERT(lineBuffers[i]);
+    }
+}
+
+void Renderer_invalidate(const Rect& r)
+{
+    /* Clip to the screen. */
+    int16_t x0 = r.x < 0 ? 0 : r.x;
+    int16_t y0 = r.y < 0 ? 0 : r.y;
+    int16_t x1 = r.x + r.w;
+    int16_t y1 = r.y + r.h;
+    if (x1 > display->width())  x1 = display->width();
+    if (y1 > display->height()) y1 = display->height();
+
+    Rect clipped = { x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0) };
+    if (Rect_isEmpty(clipped))
+        return;
+
+    /* Absorb every rectangle the new one touches; the union may touch more. */
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (uint8_t i = 0; i < dirtyCount; i++)
+        {
+            if (Rect_touches(dirty[i], clipped))
+            {
+                clipped  = Rect_union(dirty[i], clipped);
+                dirty[i] = dirty[--dirtyCount];
+                merged   = true;
+                break;
+            }
+        }
+    }
+
+    if (dirtyCount == RENDER_MAX_DIRTY)
+    {
+        for (uint8_t i = 0; i < dirtyCount; i++)
+            clipped = Rect_union(dirty[i], clipped);
+        dirtyCount = 0;
+    }
+
+    dirty[dirtyCount++] = clipped;
+}
+
+/**
+ * @brief Expands `count` rows of a paletted canvas, from `first` on, to RGB565.
+ *
+ * @param out    First output pixel, panel byte order.
+ * @param stride Output pixels per row.
+ */
+static void expandRows(TFT_eSprite* canvas, int16_t first, int16_t count, uint16_t* out, int16_t stride)
+{
+    const int16_t  w   = canvas->width();
+    const uint8_t* src = (const uint8_t*)canvas->getPointer();
+
+    for (int16_t row = first; row < first + count; row++, out += stride)
+    {
+        if (canvasFormat == RENDER_INDEXED8)
+        {
+            const uint8_t* in = src + (size_t)row * w;
+            for (int16_t x = 0; x < w; x++)
+                out[x] = panelPalette[in[x]];
+        }
+        else
+        {
+            const uint8_t* in = src + (size_t)row * ((w + 7) / 8);
+            for (int16_t x = 0; x < w; x++)
+                out[x] = panelPalette[(in[x / 8] >> (7 - x % 8)) & 1];
+        }
+    }
+}
+
+/**
+ * @brief Sends a paletted band, or expands it into the capture frame.
+ */
+static void pushExpanded(const Rect& band, TFT_eSprite* canvas)
+{
+    if (captureFrame)
+    {
+        const int16_t stride = captureFrame->width();
+        uint16_t*     dst    = (uint16_t*)captureFrame->getPointer() + band.y * stride + band.x;
+        expandRows(canvas, 0, band.h, dst, stride);
+        return;
+    }
+
+    for (int16_t row = 0; row < band.h; row += RENDER_EXPAND_LINES)
+    {
+        const int16_t n = (band.h - row) < RENDER_EXPAND_LINES ? (int16_t)(band.h - row) : RENDER_EXPAND_LINES;
+
+        uint16_t* buffer = lineBuffers[nextLineBuffer];
+        nextLineBuffer ^= 1;
+
+        expandRows(canvas, row, n, buffer, band.w);
+        display->pushImageDMA(band.x, band.y + row, band.w, n, buffer);
+    }
+}
+
+/**
+ * @brief Composes one band and starts its DMA transfer.
+ */
+static void pushBand(const Rect& band, RenderPaintFn paint, const void* ctx)
+{
+    const uint8_t index  = nextCanvas;
+    TFT_eSprite*  canvas = canvases[index];
+    nextCanvas ^= 1;
+
+    canvas->deleteSprite();
+    DisplayMem_account(-(int32_t)canvasBytes[index]);
+
+    canvasBytes[index] = bandBytes(band.w, band.h);
+    canvas->setColorDepth(formatDepth(canvasFormat));
+    uint16_t* pixels = (uint16_t*)canvas->createSprite(band.w, band.h);
+    configASSERT(pixels);
+    DisplayMem_account((int32_t)canvasBytes[index]);
+
+    if (canvasBytes[0] + canvasBytes[1] > flushCanvasPeak)
+        flushCanvasPeak = canvasBytes[0] + canvasBytes[1];
+
+    paint(*canvas, band.x, band.y, ctx);
+
+    if (canvasFormat != RENDER_RGB565)
+    {
+        if (!captureFrame && !writeOpen)
+        {
+            display->startWrite();
+            writeOpen = true;
+        }
+
+        /* Line buffers are filled in panel byte order. */
+        bool swap = display->getSwapBytes();
+        display->setSwapBytes(false);
+        pushExpanded(band, canvas);
+        display->setSwapBytes(swap);
+
+        if (!captureFrame)
+            lastFlushBytes += (uint32_t)band.w * band.h * sizeof(uint16_t);
+        return;
+    }
+
+    if (captureFrame)
+    {
+        uint16_t*     dst    = (uint16_t*)captureFrame->getPointer();
+        const int16_t stride = captureFrame->width();
+        for (int16_t row = 0; row < band.h; row++)
+            memcpy(dst + (band.y + row) * stride + band.x, pixels + row * band.w, band.w * sizeof(uint16_t));
+        return;
+    }
+
+    if (!writeOpen)
+    {
+        display->startWrite();
+        writeOpen = true;
+    }
+
+    /* Sprite pixels are already in panel byte order. */
+    bool swap = display->getSwapBytes();
+    display->setSwapBytes(false);
+    display->pushImageDMA(band.x, band.y, band.w, band.h, pixels);
+    display->setSwapBytes(swap);
+
+    lastFlushBytes += (uint32_t)band.w * band.h * sizeof(uint16_t);
+}
+
+void Renderer_flush(RenderPaintFn paint, const void* ctx)
+{
+    Renderer_flushIndexed(paint, ctx, RENDER_RGB565, nullptr, 0);
+}
+
+void Renderer_flushIndexed(RenderPaintFn paint, const void* ctx, RenderFormat format,
+                           const uint16_t* palette, uint16_t colors)
+{
+    canvasFormat = format;
+    for (uint16_t i = 0; i < colors && i < 256; i++)
+        panelPalette[i] = (palette[i] >> 8) | (palette[i] << 8);
+
+    lastFlushBytes  = 0;
+    flushCanvasPeak = 0;
+
+    for (uint8_t i = 0; i < dirtyCount; i++)
+    {
+        const Rect& r = dirty[i];
+
+        int16_t bandHeight = (int16_t)(RENDER_CANVAS_PIXELS / r.w);
+        if (bandHeight < 1)   bandHeight = 1;
+        while (bandHeight > 1 && !DisplayMem_canAllocate(bandBytes(r.w, bandHeight)))
+            bandHeight /= 2;
+
+        for (int16_t y = r.y; y < r.y + r.h; y += bandHeight)
+        {
+            int16_t h = (r.y + r.h - y) < bandHeight ? (int16_t)(r.y + r.h - y) : bandHeight;
+            pushBand(Rect{ r.x, y, r.w, h }, paint, ctx);
+        }
+    }
+
+    dirtyCount = 0;
+}
+
+void Renderer_sync()
+{
+    if (!writeOpen)
+        return;
+
+    display->dmaWait();
+    display->endWrite();
+    writeOpen = false;
+}
+
+void Renderer_capture(TFT_eSprite* frame)
+{
+    Renderer_sync();
+    captureFrame = frame;
+}
+
+uint32_t Renderer_lastFlushBytes()
+{
+    return lastFlushBytes;
+}
+
+void Renderer_measure(const Rect& r, RenderPaintFn paint, const void* ctx, RenderFormat format,
+                      const uint16_t* palette, uint16_t colors, uint8_t repeats, RenderBench* out)
+{
+    Renderer_sync();
+
+    const int64_t startUs = esp_timer_get_time();
+    for (uint8_t i = 0; i < repeats; i++)
+    {
+        Renderer_invalidate(r);
+        Renderer_flushIndexed(paint, ctx, format, palette, colors);
+        Renderer_sync();
+    }
+
+    out->canvasBytes = (uint32_t)flushCanvasPeak;
+    out->expandBytes = (format == RENDER_RGB565) ? 0 : (uint32_t)(2 * lineBufferBytes);
+    out->flushUs     = repeats ? (uint32_t)((esp_timer_get_time() - startUs) / repeats) : 0;
+    out->sentBytes   = lastFlushBytes;
+}
@@ -0,0 +1,193 @@
+/**
+ * @file Transition.cpp
+ * @brief Screen transition implementation.
+ *
+ * While capturing, the renderer copies its bands into the frame instead
+ * of sending them (see Renderer_capture()). Each animation step then
+ * marks the part of the panel the new screen covers as dirty and lets
+ * the renderer fill its bands from the frame, shifted by the slide offset.
+ *
+ * The statistics are written by TaskRender and TaskUI and read from
+ * anywhere, so they are guarded by `statsLock`.
+ */
+#include "UI/Transition.h"
+#include "UI/Renderer.h"
+#include "UI/DisplayMem.h"
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+
+static TFT_eSprite* frame      = nullptr;
+static size_t       frameBytes = 0;
+static bool         capturing  = false;
+static std::atomic<bool> animating{ false };
+
+static TransitionStats stats = {};
+static portMUX_TYPE    statsLock = portMUX_INITIALIZER_UNLOCKED;
+
+/** @brief One animation step as handed to the renderer. */
+struct SlideView
+{
+    const uint16_t* pixels; ///< Frame pixels, panel byte order.
+    int16_t         width;  ///< Frame width.
+    int16_t         shift;  ///< Screen x of the frame's left edge.
+};
+
+static void paintSlide(TFT_eSprite& canvas, int16_t originX, int16_t originY, const void* ctx)
+{
+    const SlideView* view = (const SlideView*)ctx;
+
+    uint16_t*     dst = (uint16_t*)canvas.getPointer();
+    const int16_t w   = canvas.width();
+    const int16_t h   = canvas.height();
+
+    for (int16_t row = 0; row < h; row++)
+    {
+        const uint16_t* src = view->pixels + (originY + row) * view->width + (originX - view->shift);
+        memcpy(dst + row * w, src, w * sizeof(uint16_t));
+    }
+}
+
+/**
+ * @brief Returns how many columns of the new screen are visible after `step` steps.
+ *
+ * Eases out: fast at first, settling gently.
+ */
+static int16_t slideOffset(int16_t width, uint8_t step)
+{
+    const int32_t left = TRANSITION_FRAMES - step;
+    return (int16_t)(width - width * left * left / (TRANSITION_FRAMES * TRANSITION_FRAMES));
+}
+
+static void releaseFrame()
+{
+    frame->deleteSprite();
+    DisplayMem_account(-(int32_t)frameBytes);
+    frameBytes = 0;
+}
+
+TFT_eSprite* Transition_begin(TFT_eSPI* tft)
+{
+    if (!TRANSITIONS_ENABLED)
+        return nullptr;
+
+    if (!frame)
+    {
+        frame = new TFT_eSprite(tft);
+        frame->setColorDepth(16);
+    }
+
+    const size_t bytes = (size_t)tft->width() * tft->height() * sizeof(uint16_t);
+    if (!DisplayMem_canAllocate(bytes) || !frame->createSprite(tft->width(), tft->height()))
+        return nullptr;
+
+    frameBytes = bytes;
+    DisplayMem_account((int32_t)frameBytes);
+
+    frame->fillSprite(TFT_BLACK);
+    Renderer_capture(frame);
+    capturing = true;
+    return frame;
+}
+
+TFT_eSprite* Transition_frame()
+{
+    return capturing ? frame : nullptr;
+}
+
+void Transition_run(TransitionType type, bool (*superseded)(void))
+{
+    if (!capturing)
+        return;
+
+    Renderer_capture(nullptr);
+    capturing = false;
+    animating.store(true, std::memory_order_relaxed);
+
+    const int16_t width  = frame->width();
+    const int16_t height = frame->height();
+    const int64_t startUs = esp_timer_get_time();
+
+    SlideView  view     = { (const uint16_t*)frame->getPointer(), width, 0 };
+    uint32_t   maxStepUs = 0;
+    bool       cut       = false;
+    TickType_t wake      = xTaskGetTickCount();
+
+    const uint8_t steps = (type == TRANSITION_NONE) ? 1 : TRANSITION_FRAMES;
+
+    for (uint8_t step = 1; step <= steps; step++)
+    {
+        if (superseded && superseded())
+        {
+            cut = true;
+            break;
+        }
+
+        const int64_t stepStartUs = esp_timer_get_time();
+        const int16_t visible     = (type == TRANSITION_NONE) ? width : slideOffset(width, step);
+
+        Rect area;
+        if (type == TRANSITION_SLIDE_RIGHT)
+        {
+            view.shift = visible - width;
+            area       = Rect{ 0, 0, visible, height };
+        }
+        else
+        {
+            view.shift = width - visible;
+            area       = Rect{ view.shift, 0, visible, height };
+        }
+
+        Renderer_invalidate(area);
+        Renderer_flush(paintSlide, &view);
+
+        const uint32_t stepUs = (uint32_t)(esp_timer_get_time() - stepStartUs);
+        if (stepUs > maxStepUs) maxStepUs = stepUs;
+
+        if (step < steps)
+            vTaskDelayUntil(&wake, pdMS_TO_TICKS(TRANSITION_FRAME_MS));
+    }
+
+    /* The last bands read the renderer's canvases, not the frame, so it can go now. */
+    releaseFrame();
+    animating.store(false, std::memory_order_relaxed);
+
+    const uint32_t totalMs = (uint32_t)((esp_timer_get_time() - startUs) / 1000);
+
+    portENTER_CRITICAL(&statsLock);
+    stats.transitions++;
+    if (cut) stats.cancelled++;
+    stats.lastMs = totalMs;
+    if (maxStepUs > stats.maxFrameUs) stats.maxFrameUs = maxStepUs;
+    [[maybe_unused]] TransitionStats snapshot = stats;
+    portEXIT_CRITICAL(&statsLock);
+
+    log_d("Transition %lu ms, step max %lu us; %lu events during transitions, max %lu us",
+          (unsigned long)totalMs, (unsigned long)maxStepUs,
+          (unsigned long)snapshot.inputEvents, (unsigned long)snapshot.maxInputUs);
+}
+
+bool Transition_active()
+{
+    return animating.load(std::memory_order_relaxed);
+}
+
+void Transition_noteInput(uint32_t handledUs)
+{
+    if (!animating.load(std::memory_order_relaxed))
+        return;
+
+    portENTER_CRITICAL(&statsLock);
+    stats.inputEvents++;
+    if (handledUs > stats.maxInputUs) stats.maxInputUs = handledUs;
+    portEXIT_CRITICAL(&statsLock);
+}
+
+void Transition_getStats(TransitionStats* out)
+{
+    portENTER_CRITICAL(&statsLock);
+    *out = stats;
+    portEXIT_CRITICAL(&statsLock);
+}
@@ -1,8 +1,27 @@
 /**
  * @file UI.cpp
  * @brief TFT display rendering implementation.
+ *
+ * Screen set-up (headers, logo, QR code) is drawn directly on the TFT.
+ * Everything that changes on a detent – menu rows, confirm buttons and
+ * value fields – goes through the dirty-rectangle renderer, which only
+ * repaints the pixels that changed and pushes them with DMA.
+ *
+ * Those widgets use few colours, so they are composed in paletted
+ * canvases: menu rows in 8 bits (background, text and the icon's palette),
+ * value fields, buttons and the scrollbar in 1 bit. Only the progress bar
+ * and transitions use RGB565 canvases.
+ *
+ * During a screen transition both kinds of drawing land in the
+ * transition frame instead: direct drawing goes through screen() and
+ * pushIcon(), the renderer is switched to capture.
  */
 #include "UI/UI.h"
+#include "UI/Renderer.h"
+#include "UI/DisplayMem.h"
+#include "UI/GlyphAtlas.h"
+#include "UI/Backlight.h"
+#include "UI/Transition.h"
 #include "Config/pins.h"
 #include "images/icons.h"
 #include <TFT_eSPI.h>
@@ -21,15 +40,218 @@ static constexpr int BTN_W = 60;
 static constexpr int BTN_H = 40;
 
 static TFT_eSPI tft = TFT_eSPI();
-static TFT_eSprite iconSprite = TFT_eSprite(&tft);
-static TFT_eSprite bigIconSprite = TFT_eSprite(&tft);
-static TFT_eSprite logoIconSprite = TFT_eSprite(&tft);
+
+/* =========================
+   VALUE FIELDS
+   ========================= */
+
+/** @brief Extra pixels around a text box for glyphs overhanging their advance. */
+static constexpr int16_t TEXT_PAD = 2;
+
+/** @brief Text size of every value field. */
+static constexpr uint8_t VALUE_TEXT_SIZE = 2;
 
 /**
- * @brief Initializes TFT display, sprite buffers, and backlight GPIO.
+ * @brief A single line of text below the header that changes on every detent.
  *
- * PIN_TFT_LED is held LOW on init; the caller enables it after the boot logo
- * renders to avoid displaying noise during TFT driver startup.
+ * `box` is the screen area the current text occupies, so a change only
+ * repaints the union of the old and new text, starting at the first
+ * character that differs. The text is drawn from the field's glyph atlas,
+ * built from `glyphTexts` when the field's screen is entered and released
+ * when it is left. If memory is short the atlas stays empty and the text
+ * is rasterised from the font as before.
+ */
+struct ValueField
+{
+    const GFXfont*     font;       ///< Free font.
+    uint8_t            datum;      ///< TFT_eSPI text datum of the anchor; MR, MC or ML.
+    uint16_t           color;      ///< Text colour on black.
+    int16_t            anchorX;    ///< Anchor x.
+    int16_t            anchorY;    ///< Anchor y.
+    const char* const* glyphTexts; ///< Every string the field can show.
+    uint8_t            glyphCount; ///< Number of entries in `glyphTexts`.
+    char               text[12];   ///< Text currently on screen.
+    Rect               box;        ///< Area covered by `text`; empty when nothing is drawn.
+    GlyphAtlas         atlas;      ///< Pre-rendered glyphs.
+};
+
+static const char* const speedGlyphs[] = {
+    "0123456789"
+};
+
+static const char* const timeLabels[] = {
+    "15 MIN", "30 MIN", "45 MIN", "60 MIN", "CONT"
+};
+
+static const char* const cleanLabels[] = {
+    "RAPIDO", "LENTO", "PURGA", "MANUAL"
+};
+
+#define COUNT_OF(a) (uint8_t)(sizeof(a) / sizeof((a)[0]))
+
+static ValueField speedField  = { &FreeSans24pt7b, MR_DATUM, TFT_GREEN, SCREEN_WIDTH / 2 + 70, SCREEN_HEIGHT / 2 + 20,
+                                  speedGlyphs, COUNT_OF(speedGlyphs), "", {}, {} };
+static ValueField timeField   = { &FreeSans12pt7b, MR_DATUM, TFT_BLUE,  SCREEN_WIDTH / 2 + 70, SCREEN_HEIGHT / 2 + 20,
+                                  timeLabels,  COUNT_OF(timeLabels),  "", {}, {} };
+static ValueField systemField = { &FreeSans9pt7b,  MC_DATUM, TFT_BLUE,  SCREEN_WIDTH / 2,      SCREEN_HEIGHT / 2 + 20,
+                                  cleanLabels, COUNT_OF(cleanLabels), "", {}, {} };
+
+/* Run dashboard: small GLCD text, no atlas. Only changed digits are repainted. */
+static ValueField remainField = { nullptr, MC_DATUM, TFT_GREEN,    SCREEN_WIDTH / 2,  58,  nullptr, 0, "", {}, {} };
+static ValueField countField  = { nullptr, ML_DATUM, TFT_WHITE,    8,                 96,  nullptr, 0, "", {}, {} };
+static ValueField rateField   = { nullptr, MR_DATUM, TFT_DARKGREY, SCREEN_WIDTH - 8,  96,  nullptr, 0, "", {}, {} };
+static ValueField stateField  = { nullptr, MC_DATUM, TFT_YELLOW,   SCREEN_WIDTH / 2,  116, nullptr, 0, "", {}, {} };
+
+/* Diagnostics: one right-aligned value per line below the header. */
+static constexpr int DIAG_LINES       = 4;
+static constexpr int DIAG_FIRST_Y     = 56;
+static constexpr int DIAG_LINE_HEIGHT = 20;
+
+static ValueField diagFields[DIAG_LINES] = {
+    { nullptr, MR_DATUM, TFT_GREEN, SCREEN_WIDTH - 4, DIAG_FIRST_Y + 0 * DIAG_LINE_HEIGHT, nullptr, 0, "", {}, {} },
+    { nullptr, MR_DATUM, TFT_GREEN, SCREEN_WIDTH - 4, DIAG_FIRST_Y + 1 * DIAG_LINE_HEIGHT, nullptr, 0, "", {}, {} },
+    { nullptr, MR_DATUM, TFT_GREEN, SCREEN_WIDTH - 4, DIAG_FIRST_Y + 2 * DIAG_LINE_HEIGHT, nullptr, 0, "", {}, {} },
+    { nullptr, MR_DATUM, TFT_GREEN, SCREEN_WIDTH - 4, DIAG_FIRST_Y + 3 * DIAG_LINE_HEIGHT, nullptr, 0, "", {}, {} }
+};
+
+static const char* const diagLabels[DIAG_LINES] = { "GOTAS", "HORAS", "BOOT", "PERD." };
+
+/** @brief Field on the current screen; the only one holding an atlas. */
+static ValueField* activeField = nullptr;
+
+/**
+ * @brief Moves display memory to the screen being entered.
+ *
+ * Releases the atlas of the previous screen's field and builds the one of
+ * `field`, which is nullptr for screens without a value field.
+ */
+static void enterScreen(ValueField* field)
+{
+    if (activeField && activeField != field)
+        GlyphAtlas_release(&activeField->atlas);
+
+    if (field && !field->atlas.ready)
+        GlyphAtlas_build(&field->atlas, &tft, field->font, VALUE_TEXT_SIZE, field->color,
+                         field->glyphTexts, field->glyphCount);
+
+    activeField = field;
+}
+
+/**
+ * @brief Returns the width of the first `len` characters of `text`, as textWidth() would.
+ */
+static int16_t fieldTextWidth(const ValueField& field, const char* text, size_t len)
+{
+    if (field.atlas.ready)
+        return GlyphAtlas_textWidth(&field.atlas, text, len);
+
+    char buf[sizeof(ValueField::text)];
+    if (len >= sizeof(buf)) len = sizeof(buf) - 1;
+    memcpy(buf, text, len);
+    buf[len] = '\0';
+
+    tft.setFreeFont(field.font);
+    int16_t w = len ? tft.textWidth(buf) : 0;
+    tft.setFreeFont(nullptr);
+    return w;
+}
+
+static int16_t fieldTextHeight(const ValueField& field)
+{
+    if (field.atlas.ready)
+        return field.atlas.height;
+
+    tft.setFreeFont(field.font);
+    int16_t h = tft.fontHeight();
+    tft.setFreeFont(nullptr);
+    return h;
+}
+
+/**
+ * @brief Returns the screen area of `text` drawn at the field's anchor.
+ */
+static Rect fieldTextBox(const ValueField& field, const char* text)
+{
+    int16_t w = fieldTextWidth(field, text, strlen(text));
+    int16_t h = fieldTextHeight(field);
+
+    int16_t x = (field.datum == MR_DATUM) ? field.anchorX - w
+              : (field.datum == MC_DATUM) ? field.anchorX - w / 2
+              : field.anchorX;
+
+    return Rect{ (int16_t)(x - TEXT_PAD), (int16_t)(field.anchorY - h / 2 - TEXT_PAD),
+                 (int16_t)(w + 2 * TEXT_PAD), (int16_t)(h + 2 * TEXT_PAD) };
+}
+
+static void paintValueField(TFT_eSprite& canvas, int16_t originX, int16_t originY, const void* ctx)
+{
+    const ValueField* field = (const ValueField*)ctx;
+
+    /* Left edge of the text, undoing the padding added by fieldTextBox(). */
+    int16_t x = field->box.x + TEXT_PAD;
+
+    canvas.fillSprite(TFT_BLACK);
+
+    if (field->atlas.ready)
+    {
+        GlyphAtlas_draw(&field->atlas, canvas, field->text, x - originX, field->anchorY - originY);
+        return;
+    }
+
+    canvas.setTextSize(VALUE_TEXT_SIZE);
+    canvas.setFreeFont(field->font);
+    canvas.setTextDatum(field->datum);
+    canvas.setTextColor(field->color, TFT_BLACK);
+    canvas.drawString(field->text, field->anchorX - originX, field->anchorY - originY);
+}
+
+/**
+ * @brief Forgets what a field showed; used after the screen below it was cleared.
+ */
+static void resetValueField(ValueField& field)
+{
+    field.text[0] = '\0';
+    field.box     = Rect{};
+}
+
+/**
+ * @brief Shows `text` in a field, repainting only what changed.
+ */
+static void setValueField(ValueField& field, const char* text)
+{
+    if (strcmp(field.text, text) == 0)
+        return;
+
+    Rect newBox = fieldTextBox(field, text);
+    Rect dirtyBox = Rect_union(field.box, newBox);
+
+    /* Same position and a common prefix: the prefix glyphs are already on screen. */
+    if (!Rect_isEmpty(field.box) && field.box.x == newBox.x && field.box.w == newBox.w)
+    {
+        size_t same = 0;
+        while (field.text[same] && field.text[same] == text[same]) same++;
+
+        int16_t skip = fieldTextWidth(field, text, same);
+        dirtyBox.x += skip;
+        dirtyBox.w -= skip;
+    }
+
+    strncpy(field.text, text, sizeof(field.text) - 1);
+    field.text[sizeof(field.text) - 1] = '\0';
+    field.box = newBox;
+
+    const uint16_t palette[2] = { TFT_BLACK, field.color };
+
+    Renderer_invalidate(dirtyBox);
+    Renderer_flushIndexed(paintValueField, &field, RENDER_MONO1, palette, 2);
+}
+
+/**
+ * @brief Initializes TFT display, sprite buffers, and backlight PWM.
+ *
+ * Called from TaskRender, which owns the display. The backlight stays off
+ * on init; TaskRender turns it on after the boot logo renders to avoid
+ * displaying noise during TFT driver startup.
  */
 void UI_init()
 {
@@ -39,130 +261,280 @@ void UI_init()
     tft.setTextSize(2);
     tft.fillScreen(TFT_BLACK);
 
-    iconSprite.setSwapBytes(true);
-    iconSprite.createSprite(ICON_WIDTH, ICON_HEIGHT);
+    Renderer_init(&tft);
+
+    Backlight_init();
+}
+
+/**
+ * @brief Returns where screen set-up draws: the panel, or the transition frame while one is captured.
+ */
+static TFT_eSPI& screen()
+{
+    TFT_eSprite* frame = Transition_frame();
+    return frame ? *frame : tft;
+}
+
+/**
+ * @brief Icon_push() onto screen(); `transparent` pixels show `background`.
+ */
+static void pushIcon(int16_t x, int16_t y, const PackedIcon* icon, uint16_t transparent, uint16_t background)
+{
+    TFT_eSprite* frame = Transition_frame();
+    if (!frame)
+    {
+        Icon_push(tft, x, y, icon, transparent, background);
+        return;
+    }
+
+    frame->fillRect(x, y, icon->width, icon->height, background);
+    Icon_drawToSprite(icon, *frame, x, y, transparent);
+}
+
+void UI_drawIcon(int16_t x, int16_t y, const PackedIcon* icon)
+{
+    Renderer_sync();
+    pushIcon(x, y, icon, TFT_BLACK, TFT_BLACK);
+}
+
+bool UI_beginTransition()
+{
+    TFT_eSprite* frame = Transition_begin(&tft);
+    if (!frame)
+        return false;
+
+    frame->setTextSize(2);
+    return true;
+}
+
+void UI_endTransition(TransitionType type, bool (*superseded)(void))
+{
+    Transition_run(type, superseded);
+}
+
+/** @brief Width of the scrollbar beside menus longer than MENU_VISIBLE_ROWS. */
+static constexpr int MENU_SCROLLBAR_W = 4;
+
+/** @brief One menu row as handed to the renderer. */
+struct MenuItemView
+{
+    const char*     title;
+    const PackedIcon* icon;
+    int             y;
+    int             sectionHeight;
+    bool            selected;
+};
+
+/** @brief Palette layout of an 8-bit menu row canvas. */
+static constexpr uint8_t ROW_INDEX_BG   = 0;
+static constexpr uint8_t ROW_INDEX_FG   = 1;
+static constexpr uint8_t ROW_INDEX_ICON = 2; ///< First entry of the icon's palette.
+
+/** @brief Row palette capacity; rows with more colourful icons fall back to RGB565. */
+static constexpr uint16_t ROW_MAX_COLORS = 64;
 
-    bigIconSprite.setSwapBytes(true);
-    bigIconSprite.createSprite(ICON_WIDTH*2, ICON_HEIGHT*2);
+static void paintMenuItem(TFT_eSprite& canvas, int16_t originX, int16_t originY, const void* ctx)
+{
+    const MenuItemView* item = (const MenuItemView*)ctx;
+    const bool indexed = (canvas.getColorDepth() == 8);
+
+    int iconY = item->y + (item->sectionHeight - ICON_HEIGHT) / 2;
+    int textY = item->y + (item->sectionHeight - TEXT_HEIGHT) / 2;
+
+    uint16_t bg = indexed ? Renderer_index(ROW_INDEX_BG) : item->selected ? TFT_WHITE : TFT_BLACK;
+    uint16_t fg = indexed ? Renderer_index(ROW_INDEX_FG) : item->selected ? TFT_BLACK : TFT_DARKGREY;
 
-    logoIconSprite.setSwapBytes(true);
-    logoIconSprite.createSprite(ICON_WIDTH*4, ICON_HEIGHT*4);
+    canvas.fillSprite(bg);
 
-    pinMode(PIN_TFT_LED, OUTPUT);
-    digitalWrite(PIN_TFT_LED, LOW);
+    if (item->icon)
+    {
+        if (indexed)
+            Icon_drawIndexed(item->icon, canvas, ICON_X - originX, iconY - originY, TFT_BLACK, ROW_INDEX_ICON);
+        else
+            Icon_drawToSprite(item->icon, canvas, ICON_X - originX, iconY - originY, TFT_BLACK);
+    }
+
+    canvas.setTextSize(2);
+    canvas.setTextColor(fg, bg);
+    canvas.setCursor(TEXT_X - originX, textY - originY);
+    canvas.print(item->title);
 }
 
-void UI_drawIcon(int16_t x, int16_t y, const uint16_t* icon)
+/**
+ * @brief Fills the 8-bit canvas palette of a row.
+ *
+ * @return Entries used; 0 if the icon has no palette or too many colours,
+ *         in which case the row is composed in RGB565.
+ */
+static uint16_t menuRowPalette(const MenuItemView& item, uint16_t* palette)
 {
-    iconSprite.fillSprite(TFT_BLACK);
-    iconSprite.pushImage(0, 0, ICON_WIDTH, ICON_HEIGHT, icon);
-    iconSprite.pushSprite(x, y, TFT_BLACK);
+    const PackedIcon* icon   = item.icon;
+    const uint16_t    colors = icon ? icon->colors : 0;
+
+    if (icon && (icon->encoding == ICON_ENCODING_RAW || ROW_INDEX_ICON + colors > ROW_MAX_COLORS))
+        return 0;
+
+    palette[ROW_INDEX_BG] = item.selected ? TFT_WHITE : TFT_BLACK;
+    palette[ROW_INDEX_FG] = item.selected ? TFT_BLACK : TFT_DARKGREY;
+    for (uint16_t i = 0; i < colors; i++)
+        palette[ROW_INDEX_ICON + i] = pgm_read_word(&icon->palette[i]);
+
+    return ROW_INDEX_ICON + colors;
 }
 
-static void UI_drawMenuItem(const char* title, const uint16_t* icon, int y, int sectionHeight, bool selected)
+/**
+ * @brief Repaints the row at `y`; `width` leaves room for a scrollbar.
+ *
+ * The bottom row also covers the pixels left over by the integer row height.
+ */
+static void UI_drawMenuItem(const char* title, const PackedIcon* icon, int y, int sectionHeight, bool selected,
+                            int width = SCREEN_WIDTH)
 {
-    int iconY = y + (sectionHeight - ICON_HEIGHT) / 2;
-    int textY = y + (sectionHeight - TEXT_HEIGHT) / 2;
+    MenuItemView item = { title, icon, y, sectionHeight, selected };
+
+    int h = (y + 2 * sectionHeight > SCREEN_HEIGHT) ? SCREEN_HEIGHT - y : sectionHeight;
 
-    uint16_t bg = selected ? TFT_WHITE : TFT_BLACK;
-    uint16_t fg = selected ? TFT_BLACK : TFT_DARKGREY;
+    uint16_t palette[ROW_MAX_COLORS];
+    uint16_t colors = menuRowPalette(item, palette);
 
-    tft.fillRect(0, y, SCREEN_WIDTH, sectionHeight + 2, bg);
+    Renderer_invalidate(Rect{ 0, (int16_t)y, (int16_t)width, (int16_t)h });
+    if (colors)
+        Renderer_flushIndexed(paintMenuItem, &item, RENDER_INDEXED8, palette, colors);
+    else
+        Renderer_flush(paintMenuItem, &item);
+}
 
-    if(icon)
-        UI_drawIcon(ICON_X, iconY, icon);
-    tft.setTextColor(fg, bg);
-    tft.setCursor(TEXT_X, textY);
-    tft.print(title);
+void UI_drawMenuStatic()
+{
+    enterScreen(nullptr);
 }
 
-void UI_drawMenu(const char* const titles[], const uint16_t* const icons[], int items)
+void UI_drawMenuRow(int slot, int rows, const char* title, const PackedIcon* icon, bool selected, bool scrollbar)
 {
-    const int sectionHeight = SCREEN_HEIGHT / items;
+    const int sectionHeight = SCREEN_HEIGHT / rows;
 
-    for(int i = 0; i < items; i++)
-        UI_drawMenuItem(titles[i], icons[i], i * sectionHeight, sectionHeight, false);
+    UI_drawMenuItem(title, icon, slot * sectionHeight, sectionHeight, selected,
+                    scrollbar ? SCREEN_WIDTH - MENU_SCROLLBAR_W : SCREEN_WIDTH);
 }
 
-void UI_updateMenuSelection(const char* const* titles, const uint16_t* const* icons, int last, int current, int items)
+/** @brief Scrollbar position as handed to the renderer. */
+struct ScrollbarView
+{
+    int first;
+    int rows;
+    int count;
+};
+
+static void paintScrollbar(TFT_eSprite& canvas, int16_t originX, int16_t originY, const void* ctx)
 {
-    const int sectionHeight = SCREEN_HEIGHT / items;
+    const ScrollbarView* bar = (const ScrollbarView*)ctx;
 
-    if(last >= 0)
-        UI_drawMenuItem(titles[last], icons[last], last * sectionHeight, sectionHeight, false);
+    int thumbY = SCREEN_HEIGHT * bar->first / bar->count;
+    int thumbH = SCREEN_HEIGHT * bar->rows / bar->count;
 
-    if(current >= 0)
-        UI_drawMenuItem(titles[current], icons[current], current * sectionHeight, sectionHeight, true);
+    canvas.fillSprite(TFT_BLACK);
+    canvas.fillRect(SCREEN_WIDTH - MENU_SCROLLBAR_W + 1 - originX, thumbY - originY,
+                    MENU_SCROLLBAR_W - 1, thumbH, TFT_DARKGREY);
 }
 
-static void UI_drawHeader(const char* title, const uint16_t* icon)
+void UI_drawMenuScrollbar(int first, int rows, int count)
 {
-    const int sectionHeight = SCREEN_HEIGHT / MENU_COUNT;
-    tft.fillScreen(TFT_BLACK);
+    ScrollbarView  bar        = { first, rows, count };
+    const uint16_t palette[2] = { TFT_BLACK, TFT_DARKGREY };
+
+    Renderer_invalidate(Rect{ SCREEN_WIDTH - MENU_SCROLLBAR_W, 0, MENU_SCROLLBAR_W, SCREEN_HEIGHT });
+    Renderer_flushIndexed(paintScrollbar, &bar, RENDER_MONO1, palette, 2);
+}
+
+static void UI_drawHeader(const char* title, const PackedIcon* icon)
+{
+    const int sectionHeight = SCREEN_HEIGHT / MENU_VISIBLE_ROWS;
+    Renderer_sync();
+    screen().fillScreen(TFT_BLACK);
     UI_drawMenuItem(title, icon, 0, sectionHeight, true);
 }
 
-void UI_drawConfirmStatic(const char* title, const uint16_t* icon)
+void UI_drawConfirmStatic(const char* title, const PackedIcon* icon)
 {
     UI_drawHeader(title, icon);
+    enterScreen(nullptr);
     UI_drawConfirmButtons(0);
 }
 
-void UI_drawConfirmButtons(int selected)
+/** @brief Buttons are white on black; the painter's colours map onto it in a 1-bit canvas. */
+static const uint16_t buttonPalette[2] = { TFT_BLACK, TFT_WHITE };
+
+static void paintConfirmButtons(TFT_eSprite& canvas, int16_t originX, int16_t originY, const void* ctx)
 {
-    const int center = SCREEN_WIDTH / 2;
+    const int selected = *(const int*)ctx;
+    const int center   = SCREEN_WIDTH / 2;
 
-    int yesX = center - BTN_W - 10;
-    int noX  = center + 10;
+    int yesX = center - BTN_W - 10 - originX;
+    int noX  = center + 10 - originX;
+    int y    = BTN_Y - originY;
 
-    tft.fillRect(yesX, BTN_Y, BTN_W, BTN_H, selected == 0 ? TFT_WHITE : TFT_BLACK);
-    tft.drawRect(yesX, BTN_Y, BTN_W, BTN_H, TFT_WHITE);
+    canvas.fillSprite(TFT_BLACK);
 
-    tft.fillRect(noX, BTN_Y, BTN_W, BTN_H, selected == 1 ? TFT_WHITE : TFT_BLACK);
-    tft.drawRect(noX, BTN_Y, BTN_W, BTN_H, TFT_WHITE);
+    canvas.fillRect(yesX, y, BTN_W, BTN_H, selected == 0 ? TFT_WHITE : TFT_BLACK);
+    canvas.drawRect(yesX, y, BTN_W, BTN_H, TFT_WHITE);
 
-    tft.setTextDatum(MC_DATUM);
+    canvas.fillRect(noX, y, BTN_W, BTN_H, selected == 1 ? TFT_WHITE : TFT_BLACK);
+    canvas.drawRect(noX, y, BTN_W, BTN_H, TFT_WHITE);
 
-    tft.setTextColor(selected == 0 ? TFT_BLACK : TFT_WHITE);
-    tft.drawString("SI", yesX + BTN_W / 2, BTN_Y + BTN_H / 2);
+    canvas.setTextSize(2);
+    canvas.setTextDatum(MC_DATUM);
 
-    tft.setTextColor(selected == 1 ? TFT_BLACK : TFT_WHITE);
-    tft.drawString("NO", noX + BTN_W / 2, BTN_Y + BTN_H / 2);
+    canvas.setTextColor(selected == 0 ? TFT_BLACK : TFT_WHITE);
+    canvas.drawString("SI", yesX + BTN_W / 2, y + BTN_H / 2);
+
+    canvas.setTextColor(selected == 1 ? TFT_BLACK : TFT_WHITE);
+    canvas.drawString("NO", noX + BTN_W / 2, y + BTN_H / 2);
+}
+
+void UI_drawConfirmButtons(int selected)
+{
+    const int center = SCREEN_WIDTH / 2;
+
+    Renderer_invalidate(Rect{ (int16_t)(center - BTN_W - 10), BTN_Y, BTN_W, BTN_H });
+    Renderer_invalidate(Rect{ (int16_t)(center + 10),         BTN_Y, BTN_W, BTN_H });
+    Renderer_flushIndexed(paintConfirmButtons, &selected, RENDER_MONO1, buttonPalette, 2);
 }
 
 void UI_drawBootLogo()
 {
-    tft.fillScreen(TFT_WHITE);
+    enterScreen(nullptr);
+    Renderer_sync();
+    screen().fillScreen(TFT_WHITE);
 
-    const int iconSize = ICON_WIDTH * 4;
-    logoIconSprite.fillSprite(TFT_BLACK);
-    logoIconSprite.pushImage(0, 0, iconSize, iconSize, logoIcon);
-    logoIconSprite.pushSprite(SCREEN_WIDTH/2 - iconSize/2, SCREEN_HEIGHT/2 - iconSize/2, TFT_BLACK);
+    pushIcon(SCREEN_WIDTH/2 - logoIcon.width/2, SCREEN_HEIGHT/2 - logoIcon.height/2, &logoIcon, TFT_BLACK, TFT_WHITE);
 
-    tft.setFreeFont(&FreeSerifBoldItalic9pt7b);
+    TFT_eSPI& dst = screen();
+    dst.setFreeFont(&FreeSerifBoldItalic9pt7b);
 
     const char* text1 = "Bio";
     const char* text2 = "Gelato";
 
-    int w1 = tft.textWidth(text1);
-    int w2 = tft.textWidth(text2);
+    int w1 = dst.textWidth(text1);
+    int w2 = dst.textWidth(text2);
     int totalWidth = w1 + w2;
 
     int x = (SCREEN_WIDTH - totalWidth) / 2;
     int y = SCREEN_HEIGHT / 2;
 
-    tft.setTextColor(TFT_BLUE);
-    tft.drawString(text1, x, y);
+    dst.setTextColor(TFT_BLUE);
+    dst.drawString(text1, x, y);
 
-    tft.setTextColor(TFT_DARKGREEN);
-    tft.drawString(text2, x + w1, y);
+    dst.setTextColor(TFT_DARKGREEN);
+    dst.drawString(text2, x + w1, y);
 
-    tft.setFreeFont(nullptr);
+    dst.setFreeFont(nullptr);
 }
 
 void UI_drawSpeedStatic()
 {
-    UI_drawHeader("VELOCIDAD", percentageIcon);
+    UI_drawHeader("VELOCIDAD", &percentageIcon);
+    enterScreen(&speedField);
+    resetValueField(speedField);
 }
 
 void UI_updateSpeed(int speed)
@@ -170,75 +542,249 @@ void UI_updateSpeed(int speed)
     char buf[8];
     snprintf(buf, sizeof(buf), "%d", speed);
 
-    tft.fillRect(0, SCREEN_HEIGHT / MENU_COUNT, SCREEN_WIDTH, SCREEN_HEIGHT, TFT_BLACK);
-
-    tft.setTextDatum(MR_DATUM);
-    tft.setFreeFont(&FreeSans24pt7b);
-    tft.setTextColor(TFT_GREEN, TFT_BLACK);
-
-    int centerX = SCREEN_WIDTH  / 2 + 70;
-    int centerY = SCREEN_HEIGHT / 2 + 20;
-    tft.drawString(buf, centerX, centerY);
-
-    tft.setFreeFont(nullptr);
+    setValueField(speedField, buf);
 }
 
-static const char* const timeLabels[] = {
-    "15 MIN", "30 MIN", "45 MIN", "60 MIN", "CONT"
-};
-
 void UI_drawTimeSelectStatic()
 {
-    UI_drawHeader("TIMER", timerIcon);
+    UI_drawHeader("TIMER", &timerIcon);
+    enterScreen(&timeField);
+    resetValueField(timeField);
 }
 
 void UI_updateTimeSelect(int index)
 {
-    tft.fillRect(0, SCREEN_HEIGHT / MENU_COUNT, SCREEN_WIDTH, SCREEN_HEIGHT, TFT_BLACK);
-
-    tft.setTextDatum(MR_DATUM);
-    tft.setFreeFont(&FreeSans12pt7b);
-    tft.setTextColor(TFT_BLUE, TFT_BLACK);
-
-    int centerX = SCREEN_WIDTH  / 2 + 70;
-    int centerY = SCREEN_HEIGHT / 2 + 20;
-    tft.drawString(timeLabels[index], centerX, centerY);
-
-    tft.setFreeFont(nullptr);
+    setValueField(timeField, timeLabels[index]);
 }
 
-static const char* const cleanLabels[] = {
-    "RAPIDO", "LENTO", "PURGA", "MANUAL"
-};
-
 void UI_drawReviewSystem()
 {
     UI_drawHeader("LIMPIEZA", nullptr);
+    enterScreen(&systemField);
+    resetValueField(systemField);
 }
 
 void UI_updateSystemSelect(int index)
 {
-    tft.fillRect(0, SCREEN_HEIGHT / MENU_COUNT, SCREEN_WIDTH, SCREEN_HEIGHT, TFT_BLACK);
+    setValueField(systemField, cleanLabels[index]);
+}
 
-    tft.setTextDatum(MC_DATUM);
-    tft.setFreeFont(&FreeSans9pt7b);
-    tft.setTextColor(TFT_BLUE, TFT_BLACK);
+/* =========================
+   RUN DASHBOARD
+   ========================= */
 
-    int centerX = SCREEN_WIDTH  / 2;
-    int centerY = SCREEN_HEIGHT / 2 + 20;
-    tft.drawString(cleanLabels[index], centerX, centerY);
+static constexpr int16_t RUN_BAR_X = 10;
+static constexpr int16_t RUN_BAR_Y = 72;
+static constexpr int16_t RUN_BAR_W = SCREEN_WIDTH - 2 * RUN_BAR_X;
+static constexpr int16_t RUN_BAR_H = 10;
 
-    tft.setFreeFont(nullptr);
+/** @brief Filled width of the progress bar interior on screen; -1 after a full redraw. */
+static int16_t runBarShown = -1;
+
+static void paintRunBar(TFT_eSprite& canvas, int16_t originX, int16_t originY, const void* ctx)
+{
+    const int16_t filled = *(const int16_t*)ctx;
+
+    canvas.fillSprite(TFT_BLACK);
+    canvas.drawRect(RUN_BAR_X - originX, RUN_BAR_Y - originY, RUN_BAR_W, RUN_BAR_H, TFT_WHITE);
+    canvas.fillRect(RUN_BAR_X + 1 - originX, RUN_BAR_Y + 1 - originY, filled, RUN_BAR_H - 2, TFT_GREEN);
+}
+
+/**
+ * @brief Moves the bar to `filled` pixels, repainting only the columns that changed.
+ */
+static void setRunBar(int16_t filled)
+{
+    if (filled == runBarShown)
+        return;
+
+    if (runBarShown < 0)
+    {
+        Renderer_invalidate(Rect{ RUN_BAR_X, RUN_BAR_Y, RUN_BAR_W, RUN_BAR_H });
+    }
+    else
+    {
+        int16_t from = filled < runBarShown ? filled : runBarShown;
+        int16_t to   = filled < runBarShown ? runBarShown : filled;
+        Renderer_invalidate(Rect{ (int16_t)(RUN_BAR_X + 1 + from), (int16_t)(RUN_BAR_Y + 1),
+                                  (int16_t)(to - from), (int16_t)(RUN_BAR_H - 2) });
+    }
+
+    runBarShown = filled;
+    Renderer_flush(paintRunBar, &filled);
+}
+
+void UI_drawRunStatic()
+{
+    UI_drawHeader("EN CURSO", &timerIcon);
+    enterScreen(nullptr);
+
+    resetValueField(remainField);
+    resetValueField(countField);
+    resetValueField(rateField);
+    resetValueField(stateField);
+    runBarShown = -1;
+}
+
+void UI_updateRun(const MotorStatus& status)
+{
+    char buf[sizeof(ValueField::text)];
+
+    /* Remaining time, rounded up so the display reaches 00:00 when the run ends. */
+    if (status.totalMs == 0)
+    {
+        setValueField(remainField, "CONT");
+    }
+    else
+    {
+        uint32_t secs = (status.remainingMs + 999) / 1000;
+        snprintf(buf, sizeof(buf), "%02lu:%02lu", (unsigned long)(secs / 60), (unsigned long)(secs % 60));
+        setValueField(remainField, buf);
+    }
+
+    int16_t filled = 0;
+    if (status.totalMs > 0 && status.remainingMs <= status.totalMs)
+        filled = (int16_t)((uint64_t)(status.totalMs - status.remainingMs) * (RUN_BAR_W - 2) / status.totalMs);
+    if (status.mode == MOTOR_MODE_IDLE && status.totalMs > 0)
+        filled = RUN_BAR_W - 2;
+    setRunBar(filled);
+
+    if (status.mode == MOTOR_MODE_CALIBRATING)
+    {
+        setValueField(countField, "CAL");
+        setValueField(rateField, "");
+    }
+    else if (status.mode == MOTOR_MODE_CLEANING)
+    {
+        uint8_t cycle = status.cyclesTotal - status.cyclesLeft + 1;
+        if (cycle > status.cyclesTotal) cycle = status.cyclesTotal;
+        snprintf(buf, sizeof(buf), "C %u/%u", cycle, status.cyclesTotal);
+        setValueField(countField, buf);
+        setValueField(rateField, "");
+    }
+    else
+    {
+        snprintf(buf, sizeof(buf), "%lu", (unsigned long)status.pulses);
+        setValueField(countField, buf);
+
+        if (status.dripPerMin > 0)
+            snprintf(buf, sizeof(buf), "%u/m", status.dripPerMin);
+        else
+            buf[0] = '\0';
+        setValueField(rateField, buf);
+    }
+
+    setValueField(stateField, status.paused                   ? "PAUSA"
+                            : status.mode == MOTOR_MODE_IDLE  ? "FIN"
+                            : "");
+}
+
+void UI_drawDiagnosticsStatic()
+{
+    UI_drawHeader("DIAGNOST", &settingsIcon);
+    enterScreen(nullptr);
+
+    Renderer_sync();
+    TFT_eSPI& dst = screen();
+    dst.setTextDatum(ML_DATUM);
+    dst.setTextColor(TFT_DARKGREY, TFT_BLACK);
+    for (int i = 0; i < DIAG_LINES; i++)
+    {
+        dst.drawString(diagLabels[i], 4, DIAG_FIRST_Y + i * DIAG_LINE_HEIGHT);
+        resetValueField(diagFields[i]);
+    }
+    dst.setTextDatum(TL_DATUM);
+}
+
+void UI_updateDiagnostics(const DiagnosticsView& view)
+{
+    const uint32_t values[DIAG_LINES] = { view.pulses, view.pumpHours, view.bootMs, view.inputDropped };
+    char buf[sizeof(ValueField::text)];
+
+    for (int i = 0; i < DIAG_LINES; i++)
+    {
+        snprintf(buf, sizeof(buf), "%lu", (unsigned long)values[i]);
+        setValueField(diagFields[i], buf);
+    }
 }
 
 void UI_drawReviewSoft()
 {
-    tft.fillScreen(TFT_BLACK);
+    enterScreen(nullptr);
+    Renderer_sync();
+    screen().fillScreen(TFT_BLACK);
     UI_drawHeader(VERSION_STRING, nullptr);
 
-    const int iconSize = ICON_WIDTH * 2;
+    Renderer_sync();
+    pushIcon(SCREEN_WIDTH/2 -35, SCREEN_HEIGHT/2 - 10, &QRIcon, TFT_BLACK, TFT_BLACK);
+}
+/* =========================
+   CANVAS FORMAT BENCHMARK
+   ========================= */
+
+/** @brief Flushes averaged per measurement. */
+static constexpr uint8_t RENDER_BENCH_REPEATS = 20;
 
-    bigIconSprite.fillSprite(TFT_BLACK);
-    bigIconSprite.pushImage(0, 0, iconSize, iconSize, QRIcon);
-    bigIconSprite.pushSprite(SCREEN_WIDTH/2 -35, SCREEN_HEIGHT/2 - 10, TFT_BLACK);
-}
\ No newline at end of file
+static void logBench(const char* element, const char* format, const RenderBench& bench)
+{
+    log_i("Render %-7s %-6s canvas %5lu B + lines %4lu B, %5lu us, %5lu B sent",
+          element, format, (unsigned long)bench.canvasBytes, (unsigned long)bench.expandBytes,
+          (unsigned long)bench.flushUs, (unsigned long)bench.sentBytes);
+}
+
+void UI_benchmarkRender()
+{
+    RenderBench bench;
+
+    /* Selected menu row with its icon. */
+    const int16_t rowH    = SCREEN_HEIGHT / MENU_VISIBLE_ROWS;
+    MenuItemView  row     = { "INICIO", &homeIcon, 0, rowH, true };
+    const Rect    rowRect = { 0, 0, SCREEN_WIDTH, rowH };
+
+    uint16_t rowPalette[ROW_MAX_COLORS];
+    uint16_t rowColors = menuRowPalette(row, rowPalette);
+
+    Renderer_measure(rowRect, paintMenuItem, &row, RENDER_RGB565, nullptr, 0, RENDER_BENCH_REPEATS, &bench);
+    logBench("row", "rgb565", bench);
+    Renderer_measure(rowRect, paintMenuItem, &row, RENDER_INDEXED8, rowPalette, rowColors, RENDER_BENCH_REPEATS, &bench);
+    logBench("row", "index8", bench);
+
+    /* Speed value drawn from its glyph atlas. */
+    [[maybe_unused]] const size_t memBefore = DisplayMem_inUse();
+    enterScreen(&speedField);
+
+    if (speedField.atlas.ready)
+    {
+        [[maybe_unused]] size_t rgb565Bytes = 0;
+        for (uint8_t i = 0; i < speedField.atlas.count; i++)
+            rgb565Bytes += (size_t)speedField.atlas.glyphs[i].w * speedField.atlas.glyphs[i].h * sizeof(uint16_t);
+
+        log_i("Render atlas   mono   %5u B, as rgb565 %5u B",
+              (unsigned)(DisplayMem_inUse() - memBefore), (unsigned)rgb565Bytes);
+    }
+
+    strcpy(speedField.text, "100");
+    speedField.box = fieldTextBox(speedField, speedField.text);
+    const uint16_t fieldPalette[2] = { TFT_BLACK, speedField.color };
+
+    Renderer_measure(speedField.box, paintValueField, &speedField, RENDER_RGB565, nullptr, 0,
+                     RENDER_BENCH_REPEATS, &bench);
+    logBench("text", "rgb565", bench);
+    Renderer_measure(speedField.box, paintValueField, &speedField, RENDER_MONO1, fieldPalette, 2,
+                     RENDER_BENCH_REPEATS, &bench);
+    logBench("text", "mono", bench);
+
+    resetValueField(speedField);
+    enterScreen(nullptr);
+
+    /* Both confirm buttons. */
+    int        selected = 0;
+    const Rect buttons  = { (int16_t)(SCREEN_WIDTH / 2 - BTN_W - 10), BTN_Y, (int16_t)(2 * BTN_W + 20), BTN_H };
+
+    Renderer_measure(buttons, paintConfirmButtons, &selected, RENDER_RGB565, nullptr, 0, RENDER_BENCH_REPEATS, &bench);
+    logBench("buttons", "rgb565", bench);
+    Renderer_measure(buttons, paintConfirmButtons, &selected, RENDER_MONO1, buttonPalette, 2, RENDER_BENCH_REPEATS, &bench);
+    logBench("buttons", "mono", bench);
+
+    Renderer_sync();
+}
@@ -1,20 +1,65 @@
 /**
  * @file UIState.cpp
  * @brief Implementation of the UI Finite State Machine.
+ *
+ * Event handlers only update the model and never draw, so every event is
+ * handled in microseconds. TaskRender calls UI_render() at most once per
+ * frame; it takes a snapshot of the model and draws the difference to what
+ * it showed last, so a burst of detents costs a single redraw of the newest
+ * value.
+ *
+ * A new screen slides in: left when going deeper, right after a back
+ * gesture (goBack()). It is composed off-screen first, see Transition.h.
  */
 #include "UI/UIState.h"
+#include "Input/EncoderAccel.h"
+#include "Input/InputRing.h"
+#include "Motor/MotorCounters.h"
+#include "Motor/MotorCalibration.h"
+#include "Config/BootProfile.h"
+#include "Tasks/TaskRender.h"
+#include <freertos/semphr.h>
+#include <esp_timer.h>
 
 // =====================
 // MENU DEFINITIONS
 // =====================
-static const char* const mainMenuTitles[]    = {"INICIO", "SISTEMA", "APAGAR"};
-static const uint16_t* const mainMenuIcons[] = { homeIcon, systemIcon, powerOffIcon };
+static void actionSpeedPreset(int percent);
+static bool calibrationAvailable();
+
+static constexpr MenuItem mainMenuItems[] = {
+    { "INICIO",    &homeIcon,        MENU_MAIN_START_MOTOR,    nullptr,           0   },
+    { "SISTEMA",   &systemIcon,      MENU_MAIN_REVIEW,         nullptr,           0   },
+    { "APAGAR",    &powerOffIcon,    MENU_POWER_OFF,           nullptr,           0   }
+};
+
+static constexpr MenuItem startMenuItems[] = {
+    { "TIMER",     &timerIcon,       MENU_MAIN_TIME_SELECT,    nullptr,           0   },
+    { "VELOCIDAD", &percentageIcon,  MENU_MAIN_SPEED_CONTROL,  nullptr,           0   },
+    { "PRESETS",   &percentageIcon,  MENU_START_PRESETS,       nullptr,           0   }
+};
+
+static constexpr MenuItem presetMenuItems[] = {
+    { "25 %",      &percentageIcon,  MENU_MAIN_SPEED_CONTROL,  actionSpeedPreset, 25  },
+    { "50 %",      &percentageIcon,  MENU_MAIN_SPEED_CONTROL,  actionSpeedPreset, 50  },
+    { "75 %",      &percentageIcon,  MENU_MAIN_SPEED_CONTROL,  actionSpeedPreset, 75  },
+    { "100 %",     &percentageIcon,  MENU_MAIN_SPEED_CONTROL,  actionSpeedPreset, 100 }
+};
 
-static const char* const systemMenuTitles[]    = {"LIMPIEZA", "INFO", "GUARDAR"};
-static const uint16_t* const systemMenuIcons[] = { homeIcon, aboutIcon, saveIcon };
+static constexpr MenuItem systemMenuItems[] = {
+    { "LIMPIEZA",  &homeIcon,        MENU_REVIEW_SYSTEM,       nullptr,           0   },
+    { "CALIBRAR",  &motorTuningIcon, MENU_CALIBRATE_CONFIRM,   nullptr,           0,  calibrationAvailable },
+    { "DIAGNOST",  &settingsIcon,    MENU_DIAGNOSTICS,         nullptr,           0   },
+    { "INFO",      &aboutIcon,       MENU_REVIEW_SOFTWARE,     nullptr,           0   },
+    { "GUARDAR",   &saveIcon,        MENU_REVIEW_SAVE_CONFIRM, nullptr,           0   }
+};
+
+#define MENU_DEF(items, back) { items, (uint8_t)(sizeof(items) / sizeof((items)[0])), back }
 
-static const char* const mainStartTitles[]    = {"TIMER", "VELOCIDAD"};
-static const uint16_t* const mainStartIcons[] = { timerIcon, percentageIcon};
+static constexpr MenuDef mainMenu   = MENU_DEF(mainMenuItems,   MENU_MAIN);
+static constexpr MenuDef startMenu  = MENU_DEF(startMenuItems,  MENU_MAIN);
+static constexpr MenuDef presetMenu = MENU_DEF(presetMenuItems, MENU_MAIN_START_MOTOR);
+static constexpr MenuDef systemMenu = MENU_DEF(systemMenuItems, MENU_MAIN);
 
 static const uint32_t timeOptions[] = {
     15 * 60 * 1000,
@@ -32,10 +77,11 @@ static const MotorCmdType cleanCmdMap[] =
     MOTOR_CMD_CLEAN_MANUAL
 };
 
-static constexpr uint32_t FAST_THRESHOLD_MS  = 80;
-static constexpr uint32_t RESET_THRESHOLD_MS = 300;
-static constexpr uint8_t  MAX_STEP           = 10;
-static constexpr uint8_t  STEP_INCREMENT     = 2;
+/** @brief Speed change per detent while the button is held. */
+static constexpr int SPEED_COARSE_STEP = 10;
+
+/** @brief Minimum gap between limit beeps; the error melody itself lasts about 320 ms. */
+static constexpr uint32_t LIMIT_BEEP_INTERVAL_MS = 1500;
 
 #define CLEAN_OPTION_COUNT (sizeof(cleanCmdMap)/sizeof(cleanCmdMap[0]))
 static_assert(sizeof(timeOptions)/sizeof(timeOptions[0]) == TIME_OPTION_COUNT,
@@ -44,121 +90,153 @@ static_assert(sizeof(timeOptions)/sizeof(timeOptions[0]) == TIME_OPTION_COUNT,
 // =====================
 // INTERNAL VARIABLES
 // =====================
-static int confirmIndex = 0;
+static UIModel model = {
+    .state          = UI_STATE_INVALID,
+    .screenSeq      = 0,
+    .transition     = TRANSITION_NONE,
+    .menuIndex      = 0,
+    .menuTop        = 0,
+    .confirmIndex   = 0,
+    .timeIndex      = TIME_DEFAULT_INDEX,
+    .cleanModeIndex = 0,
+    .motorSpeed     = 0,
+    .runReturnState = MENU_MAIN
+};
+
+static EncoderAccel speedAccel;
+
+/**
+ * @brief Guards `model` between TaskUI, TaskRender and the tasks that
+ *        change state directly (settings load, wake-up).
+ *
+ * Recursive because handlers call UI_setState() while holding it.
+ */
+static SemaphoreHandle_t modelLock = nullptr;
+
+/** @brief Set by goBack() so the next state change slides the other way. */
+static bool navigatingBack = false;
 
-static uint8_t timeIndex = TIME_DEFAULT_INDEX;
-static uint8_t cleanModeIndex = 0;
-static int motorSpeed = 0;
+/** @brief screenSeq of the screen TaskRender is drawing. */
+static uint32_t drawingSeq = 0;
 
-static UIState currentState = UI_STATE_INVALID;
+/** @brief Period of the run dashboard refresh. */
+static constexpr uint32_t RUN_REFRESH_MS = 1000;
 
-static int currentMenu = 0;
-static int lastMenu    = -1;
+/**
+ * @brief Time until the screen being drawn needs another frame without a
+ *        model change; UINT32_MAX if never. Set by render hooks.
+ */
+static uint32_t refreshInMs = UINT32_MAX;
 
 // =====================
 // INTERNAL HELPERS
 // =====================
-static void UI_enterMenu(const char* const titles[], const uint16_t* const icons[], int items)
+/**
+ * @brief UI_setState() for back gestures: the new screen slides in from the left.
+ */
+static void goBack(UIState state)
 {
-    currentMenu = 0;
-    lastMenu    = 0;
+    navigatingBack = true;
+    UI_setState(state);
+}
 
-    UI_drawMenu(titles, icons, items);
-    UI_updateMenuSelection(titles, icons, lastMenu, currentMenu, items);
+static inline uint8_t clampIndex(int v,uint8_t max)
+{
+    v %= max;
+    if(v < 0) v += max;
+    return (uint8_t)v;
 }
 
-static void handleGenericMenu(EncoderEvent evt,
-                              const char* const titles[],
-                              const uint16_t* const icons[],
-                              int optionCount,
-                              const UIState* transitions)
+/**
+ * @brief Moves the highlight by `delta` entries, wrapping at both ends,
+ *        and scrolls the viewport just enough to keep it visible.
+ */
+static void moveMenuSelection(const MenuDef& menu, int delta)
 {
-    switch (evt) {
-        case ENC_LEFT:
-            currentMenu--;
-            break;
-        case ENC_RIGHT:
-            currentMenu++;
+    model.menuIndex = clampIndex(model.menuIndex + delta, menu.count);
+
+    if (model.menuIndex < model.menuTop)
+        model.menuTop = model.menuIndex;
+    else if (model.menuIndex >= model.menuTop + MENU_VISIBLE_ROWS)
+        model.menuTop = model.menuIndex - MENU_VISIBLE_ROWS + 1;
+}
+
+static void handleMenu(const MenuDef& menu, const InputEvent& evt)
+{
+    switch (evt.type) {
+        case ENC_ROTATE:
+        case ENC_PRESS_ROTATE:
+            moveMenuSelection(menu, evt.delta);
             break;
         case BTN_SHORT:
-            if (transitions && transitions[currentMenu] != UI_STATE_INVALID) {
-                UI_setState(transitions[currentMenu]);
+        {
+            const MenuItem& item = menu.items[model.menuIndex];
+            if (item.available && !item.available())
+            {
+                sendBuzzerCommand(BUZZER_CMD_ERROR);
+                break;
             }
-            return;
+            if (item.action)
+                item.action(item.param);
+            if (item.target != UI_STATE_INVALID)
+                UI_setState(item.target);
+            break;
+        }
         case BTN_LONG:
-            UI_setState(MENU_MAIN);
-            return;
+        case BTN_DOUBLE:
+        case BTN_REPEAT:
+            goBack(menu.back);
+            break;
         default:
-            return;
+            break;
     }
-
-    if (currentMenu < 0) currentMenu = optionCount - 1;
-    if (currentMenu >= optionCount) currentMenu = 0;
-
-    UI_updateMenuSelection(titles, icons, lastMenu, currentMenu, optionCount);
-    lastMenu = currentMenu;
 }
 
-static void handleConfirmDialog(EncoderEvent evt, void (*onAccept)(void), UIState acceptState, UIState cancelState)
+static void handleConfirmDialog(const InputEvent& evt, void (*onAccept)(void), UIState acceptState, UIState cancelState)
 {
-    switch (evt)
+    switch (evt.type)
     {
-        case ENC_LEFT:
-        case ENC_RIGHT:
-            confirmIndex ^= 1; // toggle 0<->1
-            UI_drawConfirmButtons(confirmIndex);
+        case ENC_ROTATE:
+        case ENC_PRESS_ROTATE:
+            if ((evt.delta & 1) == 0) break; // even detent count lands on the same button
+            model.confirmIndex ^= 1; // toggle 0<->1
             break;
         case BTN_SHORT:
-            if (confirmIndex == 0)
+            if (model.confirmIndex == 0)
             {
                 onAccept();
                 sendBuzzerCommand(BUZZER_CMD_CONFIRM);
                 UI_setState(acceptState);
                 return;
             }
-            UI_setState(cancelState);
+            goBack(cancelState);
             break;
         case BTN_LONG:
-            UI_setState(cancelState);
+        case BTN_DOUBLE:
+        case BTN_REPEAT:
+            goBack(cancelState);
             break;
         default:
             break;
     }
 }
 
-static inline uint8_t dinamicEncoder(uint32_t deltaTime, uint8_t& currentStep)
-{
-    
-    if (deltaTime < FAST_THRESHOLD_MS) {
-        uint8_t newStep = currentStep + STEP_INCREMENT;
-        currentStep = (newStep > MAX_STEP) ? MAX_STEP : newStep;
-    } 
-    else if (deltaTime > RESET_THRESHOLD_MS) {
-        currentStep = 1;
-    }
-    
-    return currentStep;
-}
-
-static inline uint8_t clampIndex(int v,uint8_t max)
-{
-    if(v < 0) return max - 1;
-    if(v >= max) return 0;
-    return (uint8_t)v;
-}
-
 /**
  * @brief Restores motor speed and time index from persisted NVS settings.
  */
 void UI_applySettings(const SettingsPayload& data)
 {
-    motorSpeed = data.motorSpeed;
-    timeIndex  = data.timeIndex;
+    xSemaphoreTakeRecursive(modelLock, portMAX_DELAY);
+    model.motorSpeed = data.motorSpeed;
+    model.timeIndex  = data.timeIndex;
+    xSemaphoreGiveRecursive(modelLock);
+
+    TaskRender_requestFrame();
 }
 
 static void OnsendSettingsSave()
 {
-    sendSettingsSave(SETTINGS_CMD_SAVE, motorSpeed, timeIndex);
+    sendSettingsSave(SETTINGS_CMD_SAVE, model.motorSpeed, model.timeIndex);
 }
 
 static void OnsendPowerRequest()
@@ -166,145 +244,125 @@ static void OnsendPowerRequest()
     sendPowerRequest(POWER_CMD_SHUTDOWN);
 }
 
-// =====================
-// ENTRY HOOKS
-// =====================
-static void enterInit()
+static void OnsendCalibrate()
 {
-    UI_drawBootLogo();
-    sendBuzzerCommand(BUZZER_CMD_INIT);
+    sendMotorRequest(MOTOR_CMD_CHARACTERISE, 0, 0);
+    model.runReturnState = MENU_MAIN_REVIEW;
 }
 
-static void enterMainMenu()
+/**
+ * @brief The UI characterises channel 0, which needs current sensing or a drop sensor.
+ */
+static bool calibrationAvailable()
 {
-    UI_enterMenu(mainMenuTitles, mainMenuIcons, MENU_COUNT);
+    return MotorCal_available(0);
 }
 
-static void enterStartMenu()
+static void actionSpeedPreset(int percent)
 {
-    UI_enterMenu(mainStartTitles, mainStartIcons, MENU_COUNT-1);
+    model.motorSpeed = percent;
+    sendMotorRequest(MOTOR_CMD_SET_SPEED, model.motorSpeed, 0);
+    sendBuzzerCommand(BUZZER_CMD_CONFIRM);
 }
 
-static void enterSystemMenu()
+// =====================
+// ENTRY HOOKS
+// =====================
+static void enterInit()
 {
-    UI_enterMenu(systemMenuTitles, systemMenuIcons, MENU_COUNT);
+    sendBuzzerCommand(BUZZER_CMD_INIT);
 }
 
-static void enterTimeSelect()
+static void enterMenu()
 {
-    UI_drawTimeSelectStatic();
-    UI_updateTimeSelect(timeIndex);
+    model.menuIndex = 0;
+    model.menuTop   = 0;
 }
 
 static void enterSpeedControl()
 {
-    UI_drawSpeedStatic();
-    UI_updateSpeed(motorSpeed);
-}
-
-static void enterSystem()
-{
-    UI_drawReviewSystem();
-    UI_updateSystemSelect(cleanModeIndex);
-}
-
-static void enterSaveConfirm()
-{
-    confirmIndex = 0;
-    UI_drawConfirmStatic("GUARDAR?", saveIcon);
+    EncoderAccel_reset(&speedAccel);
 }
 
-static void enterPowerOff()
+static void enterConfirm()
 {
-    confirmIndex = 0;
-    UI_drawConfirmStatic("APAGAR?", powerOffIcon);
+    model.confirmIndex = 0;
 }
 
 // =====================
 // EVENT HANDLERS
 // =====================
-static void handleInit(EncoderEvent evt)
+static void handleInit(const InputEvent& evt)
 {
-    if(evt == ENC_LEFT || evt == ENC_RIGHT)
+    if(evt.type == ENC_ROTATE || evt.type == ENC_PRESS_ROTATE)
     {
         UI_setState(MENU_MAIN);
     }
 }
 
-static void handleMainMenu(EncoderEvent evt)
-{
-    static const UIState transitions[] = {
-        MENU_MAIN_START_MOTOR,
-        MENU_MAIN_REVIEW,
-        MENU_POWER_OFF
-    };
-
-    handleGenericMenu(evt,
-                      mainMenuTitles,
-                      mainMenuIcons,
-                      MENU_COUNT,
-                      transitions);
-}
-
-static void handleMainStart(EncoderEvent evt)
-{
-    static const UIState transitions[] = {
-        MENU_MAIN_TIME_SELECT,
-        MENU_MAIN_SPEED_CONTROL
-    };
-
-    handleGenericMenu(evt,
-                      mainStartTitles,
-                      mainStartIcons,
-                      MENU_COUNT-1,
-                      transitions);
-}
-
-static void handleTimeSelect(EncoderEvent evt)
+static void handleTimeSelect(const InputEvent& evt)
 {
-    switch(evt)
+    switch(evt.type)
     {
-        case ENC_LEFT:
-            timeIndex = clampIndex(timeIndex - 1, TIME_OPTION_COUNT);
-            break;
-        case ENC_RIGHT:
-            timeIndex = clampIndex(timeIndex + 1, TIME_OPTION_COUNT);
+        case ENC_ROTATE:
+        case ENC_PRESS_ROTATE:
+            model.timeIndex = clampIndex(model.timeIndex + evt.delta, TIME_OPTION_COUNT);
             break;
         case BTN_SHORT:
-            sendMotorRequest(MOTOR_CMD_START_TIMED, 0, timeOptions[timeIndex]);
+            sendMotorRequest(MOTOR_CMD_START_TIMED, 0, timeOptions[model.timeIndex]);
             sendBuzzerCommand(BUZZER_CMD_CONFIRM);
-            return;
+            model.runReturnState = MENU_MAIN_TIME_SELECT;
+            UI_setState(MENU_RUN_DASHBOARD);
+            break;
         case BTN_LONG:
-            UI_setState(MENU_MAIN_START_MOTOR);
-            return;
-        default: return;
+        case BTN_DOUBLE:
+        case BTN_REPEAT:
+            goBack(MENU_MAIN_START_MOTOR);
+            break;
+        default: break;
     }
-    UI_updateTimeSelect(timeIndex);
 }
 
-static void handleSpeedControl(EncoderEvent evt)
+static void handleSpeedControl(const InputEvent& evt)
 {
-    static uint32_t lastChangeTime = 0;
-    static uint8_t speedStep = 1;
-    static bool wasAtLimit = false;
-    
-    switch(evt)
+    static bool     wasAtLimit      = false;
+    static bool     limitBeeped     = false;
+    static uint32_t lastLimitBeepMs = 0;
+
+    switch(evt.type)
     {
-        case ENC_LEFT:
-        case ENC_RIGHT:
+        case ENC_ROTATE:
+        case ENC_PRESS_ROTATE:
         {
-            uint32_t now = millis();
-            uint8_t step = dinamicEncoder(now - lastChangeTime, speedStep);
-            lastChangeTime = now;
+            if (evt.delta == 0) return;
 
-            int newSpeed = (evt == ENC_LEFT) ? motorSpeed - step : motorSpeed + step;
-            bool hitLimit = (newSpeed < 0) || (newSpeed > 100);
-
-            motorSpeed = constrain(newSpeed, 0, 100);
+            bool hitLimit = false;
+            if (evt.type == ENC_PRESS_ROTATE)
+            {
+                /* Coarse adjust: every detent lands on the next multiple of SPEED_COARSE_STEP. */
+                int base = (evt.delta > 0) ? model.motorSpeed / SPEED_COARSE_STEP
+                                           : (model.motorSpeed + SPEED_COARSE_STEP - 1) / SPEED_COARSE_STEP;
+                int newSpeed = (base + evt.delta) * SPEED_COARSE_STEP;
+
+                hitLimit         = (newSpeed < 0) || (newSpeed > 100);
+                model.motorSpeed = constrain(newSpeed, 0, 100);
+                EncoderAccel_reset(&speedAccel);
+            }
+            else
+            {
+                model.motorSpeed = EncoderAccel_apply(&speedAccel, ACCEL_CURVE_DEFAULT,
+                                                      evt.delta, evt.timestampMs,
+                                                      model.motorSpeed, 0, 100, &hitLimit);
+            }
 
             if (hitLimit && !wasAtLimit) {
-                speedStep = 1;
-                sendBuzzerCommand(BUZZER_CMD_ERROR);
+                EncoderAccel_reset(&speedAccel);
+                /* Wiggling against the limit re-enters it on every detent; beep at most once per interval. */
+                if (!limitBeeped || evt.timestampMs - lastLimitBeepMs >= LIMIT_BEEP_INTERVAL_MS) {
+                    sendBuzzerCommand(BUZZER_CMD_ERROR);
+                    limitBeeped     = true;
+                    lastLimitBeepMs = evt.timestampMs;
+                }
                 wasAtLimit = true;
             } else if (!hitLimit) {
                 wasAtLimit = false;
@@ -312,145 +370,464 @@ static void handleSpeedControl(EncoderEvent evt)
             break;
         }
         case BTN_SHORT:
-            sendMotorRequest(MOTOR_CMD_SET_SPEED, motorSpeed, 0);
+            sendMotorRequest(MOTOR_CMD_SET_SPEED, model.motorSpeed, 0);
             sendBuzzerCommand(BUZZER_CMD_CONFIRM);
-            speedStep = 1;
+            EncoderAccel_reset(&speedAccel);
             wasAtLimit = false;
-            return;
+            break;
         case BTN_LONG:
-            speedStep = 1;
+        case BTN_DOUBLE:
+        case BTN_REPEAT:
+            EncoderAccel_reset(&speedAccel);
             wasAtLimit = false;
-            UI_setState(MENU_MAIN_START_MOTOR);
-            return;
-        default: return;
+            goBack(MENU_MAIN_START_MOTOR);
+            break;
+        default: break;
     }
-    
-    UI_updateSpeed(motorSpeed);
 }
 
-static void handleSystemMenu(EncoderEvent evt)
+static void handleSystem(const InputEvent& evt)
 {
-    static const UIState transitions[] = {
-        MENU_REVIEW_SYSTEM,
-        MENU_REVIEW_SOFTWARE,
-        MENU_REVIEW_SAVE_CONFIRM
-    };
-
-    handleGenericMenu(evt,
-                      systemMenuTitles,
-                      systemMenuIcons,
-                      MENU_COUNT,
-                      transitions);
+    switch(evt.type)
+    {
+        case ENC_ROTATE:
+        case ENC_PRESS_ROTATE:
+            model.cleanModeIndex = clampIndex(model.cleanModeIndex + evt.delta, CLEAN_OPTION_COUNT);
+            break;
+        case BTN_SHORT:
+            if (cleanCmdMap[model.cleanModeIndex] == MOTOR_CMD_CLEAN_PURGE)
+                sendPurgeRequest(0, 0, 0, true);
+            else
+                sendMotorRequest(cleanCmdMap[model.cleanModeIndex], 0, 0);
+            sendBuzzerCommand(BUZZER_CMD_CONFIRM);
+            model.runReturnState = MENU_REVIEW_SYSTEM;
+            UI_setState(MENU_RUN_DASHBOARD);
+            break;
+        case BTN_LONG:
+        case BTN_DOUBLE:
+        case BTN_REPEAT:
+            goBack(MENU_MAIN_REVIEW);
+            break;
+        default: break;
+    }
 }
 
-static void handleSystem(EncoderEvent evt)
+/**
+ * @brief Click pauses or resumes the run, or leaves once it has finished.
+ *        A characterisation sweep cannot be paused; a click gets the error beep.
+ *        Back gestures leave the dashboard; the run carries on.
+ */
+static void handleRunDashboard(const InputEvent& evt)
 {
-    switch(evt)
+    MotorStatus status;
+
+    switch(evt.type)
     {
-        case ENC_LEFT:
-            cleanModeIndex = clampIndex(cleanModeIndex - 1, CLEAN_OPTION_COUNT);
-            break;
-        case ENC_RIGHT:
-            cleanModeIndex = clampIndex(cleanModeIndex + 1, CLEAN_OPTION_COUNT);
-            break;
         case BTN_SHORT:
-            sendMotorRequest(cleanCmdMap[cleanModeIndex], 0, 0);
+            MotorStatus_get(0, &status);
+            if (status.mode == MOTOR_MODE_CALIBRATING)
+            {
+                /* A characterisation sweep cannot be paused. */
+                sendBuzzerCommand(BUZZER_CMD_ERROR);
+                break;
+            }
+            if (status.paused)
+                sendMotorRequest(MOTOR_CMD_RESUME, 0, 0);
+            else if (status.mode != MOTOR_MODE_IDLE)
+                sendMotorRequest(MOTOR_CMD_PAUSE, 0, 0);
+            else
+            {
+                goBack(model.runReturnState);
+                break;
+            }
             sendBuzzerCommand(BUZZER_CMD_CONFIRM);
-            return;
+            break;
         case BTN_LONG:
-            UI_setState(MENU_MAIN_REVIEW);
-            return;
-        default: return;
+        case BTN_DOUBLE:
+        case BTN_REPEAT:
+            goBack(model.runReturnState);
+            break;
+        default: break;
     }
-    UI_updateSystemSelect(cleanModeIndex);
 }
 
-static void handleSaveConfirm(EncoderEvent evt)
+static void handleSaveConfirm(const InputEvent& evt)
 {
     handleConfirmDialog(evt, OnsendSettingsSave, MENU_MAIN, MENU_MAIN_REVIEW);
 }
 
-static void handleSoftInfo(EncoderEvent evt)
+static void handleSoftInfo(const InputEvent& evt)
 {
-    if (evt == BTN_LONG)
-        UI_setState(MENU_MAIN_REVIEW);
+    if (evt.type == BTN_LONG || evt.type == BTN_DOUBLE || evt.type == BTN_REPEAT)
+        goBack(MENU_MAIN_REVIEW);
 }
 
-static void handleSettingsPowerOff(EncoderEvent evt)
+static void handleSettingsPowerOff(const InputEvent& evt)
 {
     handleConfirmDialog(evt, OnsendPowerRequest, MENU_INIT, MENU_MAIN);
 }
 
+static void handleCalibrateConfirm(const InputEvent& evt)
+{
+    handleConfirmDialog(evt, OnsendCalibrate, MENU_RUN_DASHBOARD, MENU_MAIN_REVIEW);
+}
+
+static void handleDiagnostics(const InputEvent& evt)
+{
+    if (evt.type == BTN_LONG || evt.type == BTN_DOUBLE || evt.type == BTN_REPEAT)
+        goBack(MENU_MAIN_REVIEW);
+}
+
+// =====================
+// RENDER HOOKS
+// =====================
+static void drawInit(const UIModel& m)
+{
+    UI_drawBootLogo();
+}
+
+static void drawMenu(const MenuDef& menu, const UIModel& m)
+{
+    const int  rows      = menu.count < MENU_VISIBLE_ROWS ? menu.count : MENU_VISIBLE_ROWS;
+    const bool scrollbar = menu.count > MENU_VISIBLE_ROWS;
+
+    UI_drawMenuStatic();
+    for (int slot = 0; slot < rows; slot++)
+    {
+        const MenuItem& item = menu.items[m.menuTop + slot];
+        UI_drawMenuRow(slot, rows, item.title, item.icon, m.menuTop + slot == m.menuIndex, scrollbar);
+    }
+
+    if (scrollbar)
+        UI_drawMenuScrollbar(m.menuTop, rows, menu.count);
+}
+
+/**
+ * @brief Repaints only the rows whose entry or highlight changed.
+ *
+ * Scrolling by one entry shifts every row, so all visible rows are
+ * redrawn in place by the renderer. Nothing is cleared first, so the
+ * list never flickers.
+ */
+static void updateMenu(const MenuDef& menu, const UIModel& m, const UIModel& shown)
+{
+    const int  rows      = menu.count < MENU_VISIBLE_ROWS ? menu.count : MENU_VISIBLE_ROWS;
+    const bool scrollbar = menu.count > MENU_VISIBLE_ROWS;
+
+    for (int slot = 0; slot < rows; slot++)
+    {
+        const int  index       = m.menuTop + slot;
+        const bool selected    = (index == m.menuIndex);
+        const bool wasSelected = (shown.menuTop + slot == shown.menuIndex);
+
+        if (index != shown.menuTop + slot || selected != wasSelected)
+            UI_drawMenuRow(slot, rows, menu.items[index].title, menu.items[index].icon, selected, scrollbar);
+    }
+
+    if (scrollbar && m.menuTop != shown.menuTop)
+        UI_drawMenuScrollbar(m.menuTop, rows, menu.count);
+}
+
+static void drawTimeSelect(const UIModel& m)
+{
+    UI_drawTimeSelectStatic();
+    UI_updateTimeSelect(m.timeIndex);
+}
+
+static void updateTimeSelect(const UIModel& m, const UIModel& shown)
+{
+    if (m.timeIndex != shown.timeIndex)
+        UI_updateTimeSelect(m.timeIndex);
+}
+
+static void drawSpeedControl(const UIModel& m)
+{
+    UI_drawSpeedStatic();
+    UI_updateSpeed(m.motorSpeed);
+}
+
+static void updateSpeedControl(const UIModel& m, const UIModel& shown)
+{
+    if (m.motorSpeed != shown.motorSpeed)
+        UI_updateSpeed(m.motorSpeed);
+}
+
+static void drawSystem(const UIModel& m)
+{
+    UI_drawReviewSystem();
+    UI_updateSystemSelect(m.cleanModeIndex);
+}
+
+static void updateSystem(const UIModel& m, const UIModel& shown)
+{
+    if (m.cleanModeIndex != shown.cleanModeIndex)
+        UI_updateSystemSelect(m.cleanModeIndex);
+}
+
+static void drawSaveConfirm(const UIModel& m)
+{
+    UI_drawConfirmStatic("GUARDAR?", &saveIcon);
+    if (m.confirmIndex != 0)
+        UI_drawConfirmButtons(m.confirmIndex);
+}
+
+static void drawPowerOff(const UIModel& m)
+{
+    UI_drawConfirmStatic("APAGAR?", &powerOffIcon);
+    if (m.confirmIndex != 0)
+        UI_drawConfirmButtons(m.confirmIndex);
+}
+
+static void updateConfirm(const UIModel& m, const UIModel& shown)
+{
+    if (m.confirmIndex != shown.confirmIndex)
+        UI_drawConfirmButtons(m.confirmIndex);
+}
+
+static void drawSoftInfo(const UIModel& m)
+{
+    UI_drawReviewSoft();
+}
+
+static void drawCalibrateConfirm(const UIModel& m)
+{
+    UI_drawConfirmStatic("CALIBRAR?", &motorTuningIcon);
+    if (m.confirmIndex != 0)
+        UI_drawConfirmButtons(m.confirmIndex);
+}
+
+/**
+ * @brief Samples the counters and system health; refreshed once a second.
+ */
+static void updateDiagnostics(const UIModel& m, const UIModel& shown)
+{
+    MotorCounters session, lifetime;
+    MotorCounters_get(&session, &lifetime);
+
+    DiagnosticsView view = {
+        .pulses       = lifetime.pulses,
+        .pumpHours    = (uint32_t)(lifetime.onMs / (3600UL * 1000UL)),
+        .bootMs       = BootProfile_interactiveUs() / 1000,
+        .inputDropped = InputRing_dropped() + buzzerCommandsDropped()
+    };
+    UI_updateDiagnostics(view);
+
+    refreshInMs = 1000;
+}
+
+static void drawDiagnostics(const UIModel& m)
+{
+    UI_drawDiagnosticsStatic();
+    updateDiagnostics(m, m);
+}
+
+/**
+ * @brief Samples the motor status and schedules the next frame just after
+ *        the displayed second changes.
+ */
+static void updateRunDashboard(const UIModel& m, const UIModel& shown)
+{
+    MotorStatus status;
+    MotorStatus_get(0, &status);
+
+    UI_updateRun(status);
+
+    uint32_t intoSecond = status.remainingMs % RUN_REFRESH_MS;
+    refreshInMs = (status.totalMs > 0 && !status.paused && intoSecond > 0) ? intoSecond + 5 : RUN_REFRESH_MS;
+}
+
+static void drawRunDashboard(const UIModel& m)
+{
+    UI_drawRunStatic();
+    updateRunDashboard(m, m);
+}
+
 // =====================
 // STATE TABLE
 // =====================
 static const UIStateTable stateTable[] = {
 
     // MENU_INIT
-    { enterInit,         handleInit,         nullptr },
+    { enterInit,         handleInit,             nullptr, drawInit,             nullptr,            nullptr     },
 
     // MENU_MAIN
-    { enterMainMenu,     handleMainMenu,     nullptr },
+    { enterMenu,         nullptr,                nullptr, nullptr,              nullptr,            &mainMenu   },
 
     //MENU_MAIN_START_MOTOR
-    { enterStartMenu,    handleMainStart,    nullptr },
+    { enterMenu,         nullptr,                nullptr, nullptr,              nullptr,            &startMenu  },
 
     // MENU_MAIN_TIME_SELECT
-    { enterTimeSelect,   handleTimeSelect,   nullptr },
+    { nullptr,           handleTimeSelect,       nullptr, drawTimeSelect,       updateTimeSelect,   nullptr     },
 
     // MENU_MAIN_SPEED_CONTROL
-    { enterSpeedControl, handleSpeedControl, nullptr },
+    { enterSpeedControl, handleSpeedControl,     nullptr, drawSpeedControl,     updateSpeedControl, nullptr     },
 
     // MENU_MAIN_REVIEW
-    { enterSystemMenu,   handleSystemMenu,   nullptr },
+    { enterMenu,         nullptr,                nullptr, nullptr,              nullptr,            &systemMenu },
 
     // MENU_REVIEW_SYSTEM
-    { enterSystem,       handleSystem,       nullptr },
+    { nullptr,           handleSystem,           nullptr, drawSystem,           updateSystem,       nullptr     },
 
     // MENU_REVIEW_SAVE_CONFIRM
-    { enterSaveConfirm,  handleSaveConfirm,  nullptr },
+    { enterConfirm,      handleSaveConfirm,      nullptr, drawSaveConfirm,      updateConfirm,      nullptr     },
 
     // MENU_REVIEW_SOFTWARE
-    { UI_drawReviewSoft, handleSoftInfo,     nullptr },
+    { nullptr,           handleSoftInfo,         nullptr, drawSoftInfo,         nullptr,            nullptr     },
 
     // MENU_POWER_OFF
-    { enterPowerOff,  handleSettingsPowerOff, nullptr }
+    { enterConfirm,      handleSettingsPowerOff, nullptr, drawPowerOff,         updateConfirm,      nullptr     },
+
+    // MENU_RUN_DASHBOARD
+    { nullptr,           handleRunDashboard,     nullptr, drawRunDashboard,     updateRunDashboard, nullptr     },
+
+    // MENU_START_PRESETS
+    { enterMenu,         nullptr,                nullptr, nullptr,              nullptr,            &presetMenu },
+
+    // MENU_CALIBRATE_CONFIRM
+    { enterConfirm,      handleCalibrateConfirm, nullptr, drawCalibrateConfirm, updateConfirm,      nullptr     },
+
+    // MENU_DIAGNOSTICS
+    { nullptr,           handleDiagnostics,      nullptr, drawDiagnostics,      updateDiagnostics,  nullptr     }
 };
 
 // =====================
 // FSM API
 // =====================
+/**
+ * @brief Creates the model lock. Must be called before any other UI_* function.
+ */
+void UI_initState()
+{
+    modelLock = xSemaphoreCreateRecursiveMutex();
+    configASSERT(modelLock);
+}
+
 /**
  * @brief Transitions to a new UI state, invoking onExit/onEnter callbacks.
  *
+ * The new screen is drawn on the next frame.
+ *
  * @param newState Target state; no-op if equal to the current state.
  */
 void UI_setState(UIState newState)
 {
     if (newState >= UI_STATE_COUNT) return;
-    if (newState == currentState)   return;
 
-    if (currentState != UI_STATE_INVALID)
+    xSemaphoreTakeRecursive(modelLock, portMAX_DELAY);
+
+    if (newState != model.state)
     {
-        if (stateTable[currentState].onExit)
-            stateTable[currentState].onExit();
+        if (model.state != UI_STATE_INVALID)
+        {
+            if (stateTable[model.state].onExit)
+                stateTable[model.state].onExit();
+        }
+
+        const bool animate = model.state != UI_STATE_INVALID && model.state != MENU_INIT && newState != MENU_INIT;
+        model.transition   = !animate       ? TRANSITION_NONE
+                           : navigatingBack ? TRANSITION_SLIDE_RIGHT
+                           :                  TRANSITION_SLIDE_LEFT;
+
+        model.state = newState;
+        model.screenSeq++;
+
+        if (stateTable[model.state].onEnter)
+            stateTable[model.state].onEnter();
     }
+    navigatingBack = false;
 
-    currentState = newState;
+    xSemaphoreGiveRecursive(modelLock);
 
-    if (stateTable[currentState].onEnter)
-        stateTable[currentState].onEnter();
+    TaskRender_requestFrame();
 }
 
 /**
- * @brief Dispatches an encoder event to the current state's handler.
+ * @brief Dispatches an input event to the current state's handler.
  *
- * @param evt Encoder event to process.
+ * @param evt Input event to process.
  */
-void UI_processEvent(EncoderEvent evt)
+void UI_processEvent(const InputEvent& evt)
 {
-    if (stateTable[currentState].handleEvent)
-        stateTable[currentState].handleEvent(evt);
+    const int64_t startUs = esp_timer_get_time();
+
+    xSemaphoreTakeRecursive(modelLock, portMAX_DELAY);
+
+    if (model.state != UI_STATE_INVALID)
+    {
+        const UIStateTable& entry = stateTable[model.state];
+        if (entry.menu)
+            handleMenu(*entry.menu, evt);
+        else if (entry.handleEvent)
+            entry.handleEvent(evt);
+    }
+
+    xSemaphoreGiveRecursive(modelLock);
+
+    Transition_noteInput((uint32_t)(esp_timer_get_time() - startUs));
+
+    TaskRender_requestFrame();
+}
+
+/**
+ * @brief Returns true once the model has moved past the screen being drawn.
+ */
+static bool screenSuperseded()
+{
+    xSemaphoreTakeRecursive(modelLock, portMAX_DELAY);
+    bool superseded = (model.screenSeq != drawingSeq);
+    xSemaphoreGiveRecursive(modelLock);
+    return superseded;
+}
+
+/**
+ * @brief Brings the screen up to date with the model.
+ *
+ * Draws the whole screen after a state change, otherwise only what changed
+ * since the previous call. Must only be called from TaskRender.
+ *
+ * @return Milliseconds until the screen needs redrawing even if the model
+ *         stays the same (live values); UINT32_MAX if it does not.
+ */
+uint32_t UI_render()
+{
+    static UIModel shown = {};
+
+    xSemaphoreTakeRecursive(modelLock, portMAX_DELAY);
+    UIModel now = model;
+    xSemaphoreGiveRecursive(modelLock);
+
+    refreshInMs = UINT32_MAX;
+
+    if (now.state == UI_STATE_INVALID)
+        return refreshInMs;
+
+    const UIStateTable& entry = stateTable[now.state];
+
+    if (now.screenSeq != shown.screenSeq)
+    {
+        /* Compose the new screen off-screen and slide it in, or draw in place if memory is short. */
+        const bool animate = (now.transition != TRANSITION_NONE) && UI_beginTransition();
+        drawingSeq = now.screenSeq;
+
+        if (entry.menu)
+            drawMenu(*entry.menu, now);
+        else if (entry.draw)
+            entry.draw(now);
+
+        if (animate)
+            UI_endTransition(now.transition, screenSuperseded);
+    }
+    else if (entry.menu)
+    {
+        updateMenu(*entry.menu, now, shown);
+    }
+    else if (entry.update)
+    {
+        entry.update(now, shown);
+    }
+
+    shown = now;
+    return refreshInMs;
 }
 
-static_assert(UI_STATE_COUNT == (sizeof(stateTable) / sizeof(stateTable[0])));
\ No newline at end of file
+static_assert(UI_STATE_COUNT == (sizeof(stateTable) / sizeof(stateTable[0])));
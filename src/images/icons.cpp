@@ -0,0 +1,247 @@
+/* Generated by scripts/build_assets.py from src/images/icons/assets.json. Do not edit. */
+#include "images/icons.h"
+#include <pgmspace.h>
+
+static const uint16_t palette0[2] PROGMEM = {
+    0x0000, 0x8410,
+};
+
+static const uint8_t homeIconData[127] PROGMEM = {
+    0x4E, 0x84, 0x1B, 0x86, 0x02, 0x85, 0x12, 0x83, 0x02, 0x83, 0x01, 0x85, 0x11, 0x83, 0x04, 0x88,
+    0x10, 0x83, 0x06, 0x87, 0x0F, 0x83, 0x03, 0x82, 0x03, 0x86, 0x0E, 0x83, 0x03, 0x84, 0x03, 0x85,
+    0x0D, 0x83, 0x03, 0x86, 0x03, 0x84, 0x0C, 0x83, 0x03, 0x88, 0x03, 0x83, 0x0B, 0x83, 0x03, 0x8A,
+    0x03, 0x83, 0x09, 0x83, 0x03, 0x8C, 0x03, 0x83, 0x07, 0x83, 0x03, 0x8E, 0x03, 0x83, 0x05, 0x83,
+    0x03, 0x90, 0x03, 0x83, 0x03, 0x83, 0x03, 0x92, 0x03, 0x83, 0x02, 0x82, 0x03, 0x94, 0x03, 0x82,
+    0x06, 0x96, 0x09, 0x98, 0x08, 0x98, 0x08, 0x89, 0x06, 0x89, 0x08, 0x89, 0x06, 0x89, 0x08, 0x89,
+    0x06, 0x89, 0x08, 0x89, 0x06, 0x89, 0x08, 0x89, 0x06, 0x89, 0x08, 0x89, 0x06, 0x89, 0x08, 0x89,
+    0x06, 0x89, 0x08, 0x89, 0x06, 0x89, 0x08, 0x89, 0x06, 0x89, 0x08, 0x89, 0x06, 0x89, 0x44,
+};
+
+static const uint8_t settingsIconData[51] PROGMEM = {
+    0x74, 0x84, 0x1B, 0x86, 0x0B, 0x91, 0x02, 0x85, 0x08, 0x91, 0x02, 0x85, 0x17, 0x86, 0x1B, 0x84,
+    0x00, 0x10, 0x84, 0x1B, 0x86, 0x17, 0x85, 0x02, 0x91, 0x08, 0x85, 0x02, 0x91, 0x0B, 0x86, 0x1B,
+    0x84, 0x00, 0x28, 0x84, 0x1B, 0x86, 0x0B, 0x91, 0x02, 0x85, 0x08, 0x91, 0x02, 0x85, 0x17, 0x86,
+    0x1B, 0x84, 0x68,
+};
+
+static const uint8_t systemIconData[59] PROGMEM = {
+    0x00, 0x2B, 0x8A, 0x15, 0x8C, 0x13, 0x82, 0x0A, 0x82, 0x12, 0x82, 0x0A, 0x82, 0x12, 0x82, 0x0A,
+    0x82, 0x12, 0x82, 0x0A, 0x82, 0x0E, 0x96, 0x09, 0x98, 0x07, 0x9A, 0x06, 0x9A, 0x06, 0x9A, 0x06,
+    0x8B, 0x04, 0x8B, 0x06, 0x8B, 0x04, 0x8B, 0x26, 0x8B, 0x04, 0x8B, 0x06, 0x8B, 0x04, 0x8B, 0x06,
+    0x9A, 0x06, 0x9A, 0x06, 0x9A, 0x06, 0x9A, 0x07, 0x98, 0x00, 0x44,
+};
+
+static const uint8_t aboutIconData[95] PROGMEM = {
+    0x4D, 0x86, 0x17, 0x8C, 0x12, 0x90, 0x0F, 0x92, 0x0D, 0x94, 0x0B, 0x8B, 0x03, 0x88, 0x09, 0x8B,
+    0x05, 0x88, 0x07, 0x8C, 0x05, 0x89, 0x06, 0x8C, 0x05, 0x89, 0x06, 0x8D, 0x03, 0x8A, 0x05, 0x9C,
+    0x04, 0x89, 0x07, 0x8C, 0x04, 0x89, 0x07, 0x8C, 0x04, 0x89, 0x01, 0x82, 0x04, 0x8C, 0x04, 0x8C,
+    0x04, 0x8C, 0x04, 0x8C, 0x04, 0x8C, 0x04, 0x8C, 0x03, 0x8D, 0x05, 0x8A, 0x04, 0x8C, 0x06, 0x8A,
+    0x04, 0x8C, 0x06, 0x89, 0x05, 0x8C, 0x07, 0x88, 0x05, 0x82, 0x01, 0x88, 0x08, 0x88, 0x08, 0x88,
+    0x09, 0x88, 0x05, 0x89, 0x0B, 0x94, 0x0C, 0x94, 0x0E, 0x90, 0x12, 0x8C, 0x17, 0x86, 0x4D,
+};
+
+static const uint8_t saveIconData[89] PROGMEM = {
+    0x6E, 0x84, 0x1C, 0x84, 0x1C, 0x84, 0x1C, 0x84, 0x1C, 0x84, 0x1C, 0x84, 0x1C, 0x84, 0x1C, 0x84,
+    0x1C, 0x84, 0x1C, 0x84, 0x1C, 0x84, 0x1C, 0x84, 0x11, 0x83, 0x08, 0x84, 0x08, 0x83, 0x06, 0x83,
+    0x05, 0x8A, 0x05, 0x83, 0x06, 0x83, 0x05, 0x8A, 0x05, 0x83, 0x06, 0x83, 0x06, 0x88, 0x06, 0x83,
+    0x06, 0x83, 0x07, 0x86, 0x07, 0x83, 0x06, 0x83, 0x08, 0x84, 0x08, 0x83, 0x06, 0x83, 0x09, 0x82,
+    0x09, 0x83, 0x06, 0x83, 0x14, 0x83, 0x06, 0x84, 0x12, 0x84, 0x06, 0x85, 0x10, 0x85, 0x06, 0x86,
+    0x0E, 0x86, 0x06, 0x9A, 0x06, 0x9A, 0x07, 0x98, 0x64,
+};
+
+static const uint8_t motorTuningIconData[71] PROGMEM = {
+    0x33, 0x86, 0x18, 0x88, 0x17, 0x88, 0x17, 0x88, 0x18, 0x87, 0x18, 0x87, 0x19, 0x86, 0x09, 0x82,
+    0x0E, 0x87, 0x08, 0x83, 0x0E, 0x88, 0x06, 0x84, 0x0E, 0x89, 0x04, 0x85, 0x0E, 0x8A, 0x02, 0x86,
+    0x0E, 0x92, 0x0E, 0x91, 0x0E, 0x92, 0x0D, 0x92, 0x0D, 0x92, 0x0D, 0x91, 0x0E, 0x90, 0x0F, 0x8B,
+    0x14, 0x8B, 0x14, 0x8B, 0x14, 0x8B, 0x14, 0x8B, 0x14, 0x8B, 0x14, 0x8B, 0x15, 0x8A, 0x16, 0x89,
+    0x17, 0x88, 0x19, 0x86, 0x1B, 0x84, 0x39,
+};
+
+static const uint8_t powerOffIconData[128] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0,
+    0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFE, 0x7F, 0xF0, 0x1F, 0xFC, 0x3F, 0xF8, 0x3F, 0xFC, 0x3F, 0xFC,
+    0x3F, 0xFC, 0x3F, 0xFC, 0x7F, 0x0C, 0x30, 0xFE, 0x7E, 0x1C, 0x38, 0x7E, 0x7C, 0x3C, 0x3C, 0x3E,
+    0xF8, 0x7C, 0x3E, 0x1F, 0xF8, 0xFC, 0x3F, 0x1F, 0xF8, 0xFC, 0x3F, 0x1F, 0xF8, 0xFE, 0x7F, 0x1F,
+    0xF8, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF, 0xFF, 0x1F,
+    0x78, 0x7F, 0xFE, 0x1E, 0x7C, 0x3F, 0xFC, 0x3E, 0x7E, 0x1F, 0xF8, 0x7E, 0x3F, 0x0F, 0xF0, 0xFC,
+    0x3F, 0x80, 0x01, 0xFC, 0x1F, 0xC0, 0x03, 0xF8, 0x0F, 0xE0, 0x07, 0xF0, 0x07, 0xFF, 0xFF, 0xE0,
+    0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+};
+
+static const uint8_t timerIconData[97] PROGMEM = {
+    0x67, 0x92, 0x0E, 0x92, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82,
+    0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x83, 0x0C, 0x83,
+    0x0F, 0x83, 0x0A, 0x83, 0x11, 0x83, 0x08, 0x83, 0x13, 0x83, 0x06, 0x83, 0x15, 0x83, 0x04, 0x83,
+    0x16, 0x83, 0x04, 0x83, 0x15, 0x83, 0x06, 0x83, 0x13, 0x83, 0x08, 0x83, 0x11, 0x83, 0x0A, 0x83,
+    0x0F, 0x83, 0x0C, 0x83, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82,
+    0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x92, 0x0E, 0x92,
+    0x67,
+};
+
+static const uint8_t percentageIconData[99] PROGMEM = {
+    0x00, 0x04, 0x88, 0x0C, 0x84, 0x08, 0x88, 0x0C, 0x84, 0x08, 0x82, 0x04, 0x82, 0x0A, 0x86, 0x08,
+    0x82, 0x04, 0x82, 0x0A, 0x86, 0x08, 0x82, 0x04, 0x82, 0x08, 0x86, 0x0A, 0x82, 0x04, 0x82, 0x08,
+    0x86, 0x0A, 0x88, 0x06, 0x86, 0x0C, 0x88, 0x06, 0x86, 0x18, 0x86, 0x1A, 0x86, 0x18, 0x86, 0x1A,
+    0x86, 0x18, 0x86, 0x1A, 0x86, 0x18, 0x86, 0x1A, 0x86, 0x18, 0x86, 0x06, 0x88, 0x0C, 0x86, 0x06,
+    0x88, 0x0A, 0x86, 0x08, 0x82, 0x04, 0x82, 0x0A, 0x86, 0x08, 0x82, 0x04, 0x82, 0x08, 0x86, 0x0A,
+    0x82, 0x04, 0x82, 0x08, 0x86, 0x0A, 0x82, 0x04, 0x82, 0x08, 0x84, 0x0C, 0x88, 0x08, 0x84, 0x0C,
+    0x88, 0x00, 0x04,
+};
+
+static const uint16_t palette1[4] PROGMEM = {
+    0x0000, 0xFFFF, 0x4228, 0x528A,
+};
+
+static const uint8_t QRIconData[818] PROGMEM = {
+    0x40, 0xC4, 0x0D, 0x42, 0x08, 0x44, 0x04, 0x42, 0x04, 0x46, 0x0D, 0x48, 0x0D, 0x42, 0x08, 0x44,
+    0x04, 0x42, 0x04, 0x46, 0x0D, 0x48, 0x02, 0x4A, 0x01, 0x42, 0x06, 0x46, 0x02, 0x44, 0x02, 0x44,
+    0x02, 0x42, 0x02, 0x49, 0x02, 0x48, 0x02, 0x4A, 0x01, 0x42, 0x06, 0x46, 0x02, 0x44, 0x02, 0x44,
+    0x02, 0x42, 0x02, 0x49, 0x02, 0x48, 0x02, 0x42, 0x06, 0x42, 0x01, 0x42, 0x02, 0x44, 0x08, 0x46,
+    0x02, 0x46, 0x02, 0x41, 0x06, 0x42, 0x02, 0x48, 0x02, 0x42, 0x06, 0x42, 0x01, 0x42, 0x02, 0x44,
+    0x08, 0x46, 0x02, 0x46, 0x02, 0x41, 0x06, 0x42, 0x02, 0x48, 0x02, 0x42, 0x06, 0x42, 0x01, 0x46,
+    0x04, 0x42, 0x02, 0x42, 0x06, 0x42, 0x02, 0x44, 0x02, 0x41, 0x06, 0x42, 0x02, 0x48, 0x02, 0x42,
+    0x06, 0x42, 0x01, 0x46, 0x04, 0x42, 0x02, 0x42, 0x06, 0x42, 0x02, 0x44, 0x02, 0x41, 0x06, 0x42,
+    0x02, 0x48, 0x02, 0x42, 0x06, 0x42, 0x01, 0x46, 0x04, 0x44, 0x02, 0x44, 0x06, 0x44, 0x02, 0x41,
+    0x06, 0x42, 0x02, 0x48, 0x02, 0x42, 0x06, 0x42, 0x01, 0x46, 0x04, 0x44, 0x02, 0x44, 0x06, 0x44,
+    0x02, 0x41, 0x06, 0x42, 0x02, 0x48, 0x02, 0x4A, 0x01, 0x42, 0x02, 0x48, 0x02, 0x44, 0x04, 0x48,
+    0x02, 0x49, 0x02, 0x48, 0x02, 0x4A, 0x01, 0x42, 0x02, 0x48, 0x02, 0x44, 0x04, 0x48, 0x02, 0x49,
+    0x02, 0x48, 0x0D, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42,
+    0x02, 0x42, 0x0D, 0x57, 0x06, 0x42, 0x02, 0x42, 0x02, 0x42, 0x0A, 0x66, 0x04, 0x48, 0x02, 0x42,
+    0x08, 0x5D, 0x06, 0x42, 0x02, 0x41, 0x02, 0x42, 0x04, 0x42, 0x02, 0x4E, 0x06, 0x43, 0x06, 0x4C,
+    0x06, 0x42, 0x02, 0x41, 0x02, 0x42, 0x04, 0x42, 0x02, 0x4E, 0x06, 0x43, 0x06, 0x48, 0x02, 0x44,
+    0x02, 0x42, 0x02, 0x41, 0x02, 0x48, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x06, 0x42, 0x02, 0x42,
+    0x03, 0x44, 0x02, 0x48, 0x02, 0x44, 0x02, 0x42, 0x02, 0x41, 0x02, 0x48, 0x02, 0x42, 0x02, 0x42,
+    0x02, 0x42, 0x06, 0x42, 0x02, 0x42, 0x03, 0x44, 0x02, 0x48, 0x04, 0x46, 0x0B, 0x42, 0x02, 0x48,
+    0x04, 0x44, 0x06, 0x51, 0x04, 0x46, 0x0B, 0x42, 0x02, 0x48, 0x04, 0x44, 0x06, 0x59, 0x02, 0x45,
+    0x08, 0x42, 0x02, 0x42, 0x02, 0x42, 0x06, 0x42, 0x04, 0x43, 0x02, 0x42, 0x02, 0x52, 0x02, 0x45,
+    0x08, 0x42, 0x02, 0x42, 0x02, 0x42, 0x06, 0x42, 0x04, 0x43, 0x02, 0x42, 0x02, 0x4C, 0x02, 0x42,
+    0x09, 0x4C, 0x04, 0x44, 0x02, 0x42, 0x04, 0x42, 0x02, 0x43, 0x06, 0x4A, 0x02, 0x42, 0x09, 0x4C,
+    0x04, 0x44, 0x02, 0x42, 0x04, 0x42, 0x02, 0x43, 0x06, 0x48, 0x0C, 0x41, 0x02, 0x44, 0x02, 0x44,
+    0x06, 0x44, 0x0A, 0x42, 0x03, 0x42, 0x04, 0x48, 0x0C, 0x41, 0x02, 0x44, 0x02, 0x44, 0x06, 0x44,
+    0x0A, 0x42, 0x03, 0x42, 0x04, 0x54, 0x03, 0x42, 0x08, 0x46, 0x04, 0x44, 0x04, 0x42, 0x02, 0x5D,
+    0x03, 0x42, 0x08, 0x46, 0x04, 0x44, 0x04, 0x42, 0x02, 0x51, 0x06, 0x42, 0x02, 0x45, 0x02, 0x42,
+    0x02, 0x44, 0x02, 0x42, 0x04, 0x48, 0x02, 0x43, 0x04, 0x44, 0x02, 0x48, 0x06, 0x42, 0x02, 0x45,
+    0x02, 0x42, 0x02, 0x44, 0x02, 0x42, 0x04, 0x48, 0x02, 0x43, 0x04, 0x44, 0x02, 0x52, 0x04, 0x41,
+    0x06, 0x42, 0x02, 0x55, 0x06, 0x42, 0x02, 0x52, 0x04, 0x41, 0x06, 0x42, 0x02, 0x55, 0x06, 0x42,
+    0x02, 0x48, 0x02, 0x46, 0x02, 0x45, 0x02, 0x42, 0x04, 0x46, 0x02, 0x42, 0x04, 0x42, 0x0B, 0x42,
+    0x04, 0x48, 0x02, 0x46, 0x02, 0x45, 0x02, 0x42, 0x04, 0x46, 0x02, 0x42, 0x04, 0x42, 0x0B, 0x42,
+    0x04, 0x48, 0x02, 0x42, 0x02, 0x42, 0x06, 0x45, 0x04, 0x4A, 0x02, 0x48, 0x03, 0x42, 0x02, 0x4E,
+    0x02, 0x42, 0x02, 0x42, 0x06, 0x45, 0x04, 0x4A, 0x02, 0x48, 0x03, 0x42, 0x02, 0x4E, 0x02, 0x42,
+    0x02, 0x42, 0x04, 0x45, 0x02, 0x44, 0x02, 0x46, 0x0A, 0x42, 0x03, 0x42, 0x02, 0x44, 0x02, 0x48,
+    0x02, 0x42, 0x02, 0x42, 0x04, 0x45, 0x02, 0x44, 0x02, 0x46, 0x0A, 0x42, 0x03, 0x42, 0x02, 0x44,
+    0x02, 0x48, 0x02, 0x42, 0x0B, 0x44, 0x08, 0x42, 0x02, 0x42, 0x02, 0x44, 0x0D, 0x4C, 0x02, 0x42,
+    0x0B, 0x44, 0x08, 0x42, 0x02, 0x42, 0x02, 0x44, 0x0D, 0x5B, 0x04, 0x42, 0x02, 0x42, 0x02, 0x48,
+    0x06, 0x45, 0x04, 0x42, 0x04, 0x57, 0x04, 0x42, 0x02, 0x42, 0x02, 0x48, 0x06, 0x45, 0x04, 0x42,
+    0x04, 0x48, 0x0D, 0x4A, 0x02, 0x42, 0x04, 0x46, 0x04, 0x42, 0x02, 0x41, 0x02, 0x50, 0x02, 0x89,
+    0xC1, 0x01, 0x4A, 0x02, 0x42, 0x04, 0x46, 0x04, 0x42, 0x02, 0x41, 0x02, 0x50, 0x02, 0x4A, 0x01,
+    0x44, 0x02, 0x42, 0x02, 0x42, 0x02, 0x44, 0x04, 0x42, 0x04, 0x45, 0x04, 0x44, 0x02, 0x48, 0x02,
+    0x42, 0x06, 0x42, 0x01, 0x42, 0x04, 0x42, 0x02, 0x42, 0x02, 0x44, 0x06, 0x42, 0x11, 0x48, 0x02,
+    0x42, 0x06, 0x42, 0x01, 0x42, 0x04, 0x46, 0x02, 0x44, 0x06, 0x42, 0x0F, 0x4A, 0x02, 0x42, 0x06,
+    0x42, 0x01, 0x42, 0x02, 0x4A, 0x02, 0x46, 0x08, 0x42, 0x02, 0x51, 0x02, 0x42, 0x06, 0x42, 0x01,
+    0x42, 0x02, 0x4A, 0x02, 0x46, 0x08, 0x42, 0x02, 0x51, 0x02, 0x42, 0x06, 0x42, 0x01, 0x42, 0x06,
+    0x42, 0x04, 0x42, 0x04, 0x42, 0x13, 0x4A, 0x02, 0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x04,
+    0x42, 0x04, 0x42, 0x13, 0x4A, 0x02, 0x4A, 0x01, 0x46, 0x06, 0x42, 0x02, 0x42, 0x08, 0x42, 0x04,
+    0x41, 0x02, 0x44, 0x02, 0x4A, 0x02, 0x4A, 0x01, 0x46, 0x06, 0x42, 0x02, 0x42, 0x08, 0x42, 0x04,
+    0x41, 0x02, 0x44, 0x02, 0x4A, 0x0D, 0x44, 0x04, 0x44, 0x06, 0x44, 0x04, 0x42, 0x02, 0x43, 0x02,
+    0x42, 0x02, 0x4C, 0x0D, 0x44, 0x04, 0x44, 0x06, 0x44, 0x04, 0x42, 0x02, 0x43, 0x02, 0x42, 0x02,
+    0x40, 0xC8,
+};
+
+static const uint16_t palette2[24] PROGMEM = {
+    0x0000, 0xA301, 0xCBC3, 0xB342, 0xEC42, 0xED6C, 0xED2A, 0xE443,
+    0xE4A7, 0xED8E, 0xF5D0, 0xC382, 0xE485, 0xDC02, 0xECE9, 0xD3C2,
+    0xD403, 0xEC84, 0xFF7B, 0xECC6, 0xF611, 0xF6D7, 0xF695, 0xF653,
+};
+
+static const uint8_t logoIconData[1236] PROGMEM = {
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0x22, 0x08, 0x02, 0x00, 0x6A, 0x08, 0x0A, 0x00, 0x1A, 0x08, 0x04, 0x00, 0x36, 0x0E, 0x10,
+    0x02, 0x0E, 0x00, 0x18, 0x08, 0x04, 0x00, 0x34, 0x0B, 0x19, 0x21, 0x29, 0x31, 0x39, 0x10, 0x05,
+    0x0D, 0x00, 0x12, 0x0C, 0x10, 0x04, 0x0C, 0x00, 0x2F, 0x0B, 0x19, 0x41, 0x49, 0x51, 0x31, 0x39,
+    0x10, 0x07, 0x0C, 0x00, 0x11, 0x0C, 0x10, 0x04, 0x0C, 0x00, 0x2E, 0x09, 0x5A, 0x41, 0x61, 0x31,
+    0x49, 0x51, 0x31, 0x39, 0x10, 0x09, 0x0B, 0x00, 0x0E, 0x0A, 0x10, 0x0C, 0x0A, 0x00, 0x2B, 0x09,
+    0x59, 0x69, 0x71, 0x31, 0x71, 0x31, 0x61, 0x39, 0x10, 0x0C, 0x0B, 0x00, 0x0D, 0x0A, 0x10, 0x0C,
+    0x0A, 0x00, 0x2A, 0x09, 0x19, 0x79, 0x31, 0x29, 0x49, 0x71, 0x61, 0x10, 0x0F, 0x0B, 0x00, 0x0A,
+    0x0A, 0x10, 0x10, 0x0A, 0x00, 0x27, 0x09, 0x79, 0x69, 0x29, 0x31, 0x29, 0x71, 0x61, 0x81, 0x10,
+    0x10, 0x0B, 0x00, 0x09, 0x0A, 0x10, 0x10, 0x0A, 0x00, 0x26, 0x09, 0x19, 0x69, 0x32, 0x71, 0x41,
+    0x61, 0x81, 0x10, 0x12, 0x0B, 0x00, 0x08, 0x0A, 0x10, 0x10, 0x0A, 0x00, 0x25, 0x0A, 0x59, 0x71,
+    0x29, 0x31, 0x41, 0x39, 0x81, 0x10, 0x14, 0x0B, 0x00, 0x07, 0x0A, 0x10, 0x10, 0x0A, 0x00, 0x25,
+    0x09, 0x19, 0x61, 0x71, 0x31, 0x41, 0x39, 0x10, 0x17, 0x0A, 0x00, 0x05, 0x0A, 0x82, 0x3A, 0x10,
+    0x10, 0x0A, 0x00, 0x22, 0x09, 0x19, 0x79, 0x41, 0x29, 0x31, 0x71, 0x81, 0x10, 0x17, 0x0B, 0x00,
+    0x04, 0x0A, 0x82, 0x3A, 0x10, 0x10, 0x0A, 0x00, 0x22, 0x09, 0x59, 0x42, 0x29, 0x72, 0x10, 0x19,
+    0x0A, 0x00, 0x04, 0x0A, 0x72, 0x10, 0x12, 0x0A, 0x00, 0x21, 0x09, 0x19, 0x79, 0x41, 0x31, 0x29,
+    0x31, 0x61, 0x10, 0x19, 0x0B, 0x00, 0x03, 0x0A, 0x72, 0x10, 0x12, 0x0A, 0x00, 0x21, 0x09, 0x59,
+    0x62, 0x73, 0x81, 0x10, 0x1A, 0x0A, 0x00, 0x03, 0x0A, 0x32, 0x10, 0x12, 0x0A, 0x00, 0x21, 0x09,
+    0x79, 0x62, 0x33, 0x10, 0x1B, 0x0A, 0x00, 0x03, 0x0A, 0x32, 0x10, 0x12, 0x0A, 0x00, 0x21, 0x09,
+    0x69, 0x42, 0x73, 0x10, 0x1B, 0x0A, 0x00, 0x03, 0x7A, 0x42, 0x10, 0x12, 0x0A, 0x00, 0x08, 0x08,
+    0x04, 0x1A, 0x8A, 0x0C, 0x04, 0x0A, 0x43, 0x73, 0x10, 0x1C, 0x0A, 0x00, 0x02, 0x7A, 0x42, 0x10,
+    0x12, 0x0A, 0x00, 0x08, 0x08, 0x04, 0x1A, 0x8A, 0x0C, 0x04, 0x0A, 0x73, 0x43, 0x10, 0x1C, 0x0A,
+    0x00, 0x02, 0x5A, 0x4A, 0x10, 0x12, 0x0A, 0x00, 0x02, 0x0E, 0x10, 0x0C, 0x0E, 0x73, 0x63, 0x10,
+    0x1C, 0x0A, 0x00, 0x02, 0x5A, 0x4A, 0x10, 0x12, 0x0A, 0x00, 0x02, 0x0E, 0x10, 0x0C, 0x0E, 0x46,
+    0x10, 0x1C, 0x0A, 0x00, 0x04, 0x92, 0x82, 0x10, 0x0E, 0x0A, 0x00, 0x02, 0x0C, 0x10, 0x14, 0x0A,
+    0x5A, 0x39, 0x2B, 0x10, 0x1C, 0x0A, 0x00, 0x04, 0x92, 0x82, 0x10, 0x0E, 0x0A, 0x00, 0x02, 0x0C,
+    0x10, 0x14, 0x0C, 0x11, 0x33, 0x10, 0x1C, 0x0A, 0x00, 0x04, 0x9A, 0xA2, 0x62, 0x10, 0x0C, 0x0A,
+    0x06, 0x0C, 0x10, 0x1C, 0x09, 0x6B, 0x10, 0x1C, 0x0A, 0x00, 0x04, 0x9A, 0xA2, 0x62, 0x10, 0x0C,
+    0x0A, 0x06, 0x0C, 0x10, 0x1C, 0x0C, 0x10, 0x1C, 0x0A, 0x00, 0x06, 0x22, 0xAA, 0x3A, 0x82, 0x10,
+    0x06, 0x0A, 0x06, 0x0A, 0x12, 0x62, 0x10, 0x20, 0x0A, 0x10, 0x1A, 0x0A, 0x00, 0x06, 0x22, 0xAA,
+    0x3A, 0x82, 0x10, 0x06, 0x0A, 0x06, 0x0A, 0x12, 0x62, 0x10, 0x20, 0x0A, 0x10, 0x1A, 0x0A, 0x00,
+    0x08, 0x0A, 0x8A, 0x42, 0x62, 0x82, 0x32, 0x72, 0x12, 0x0C, 0x06, 0x0A, 0x12, 0x3C, 0x10, 0x22,
+    0x0A, 0x10, 0x17, 0x0A, 0x00, 0x09, 0x0A, 0x8A, 0x42, 0x62, 0x82, 0x32, 0x72, 0x12, 0x0C, 0x06,
+    0x0A, 0x12, 0x3C, 0x10, 0x22, 0x0A, 0x10, 0x17, 0x0A, 0x00, 0x0D, 0x1A, 0x6A, 0x24, 0x0C, 0x00,
+    0x00, 0x0A, 0x82, 0x72, 0x82, 0x10, 0x26, 0x0A, 0x10, 0x15, 0x0A, 0x00, 0x0D, 0x1A, 0x6A, 0x24,
+    0x0C, 0x00, 0x00, 0x0A, 0x82, 0x72, 0x82, 0x10, 0x26, 0x0A, 0x10, 0x14, 0x0B, 0x00, 0x1F, 0x1A,
+    0x12, 0x42, 0x10, 0x2C, 0x0A, 0x10, 0x12, 0x0A, 0x00, 0x20, 0x1A, 0x12, 0x42, 0x10, 0x2C, 0x0A,
+    0x10, 0x11, 0x0B, 0x00, 0x20, 0x5A, 0x72, 0x10, 0x2E, 0x0A, 0x10, 0x11, 0x0A, 0x00, 0x21, 0x5A,
+    0x72, 0x10, 0x2E, 0x0A, 0x10, 0x10, 0x0B, 0x00, 0x1F, 0x0A, 0x82, 0x3A, 0x10, 0x30, 0x0A, 0x10,
+    0x0D, 0x0B, 0x00, 0x20, 0x0A, 0x82, 0x3A, 0x10, 0x30, 0x0A, 0x10, 0x0C, 0x0B, 0x00, 0x21, 0x5A,
+    0x52, 0x10, 0x32, 0x0A, 0x10, 0x0B, 0x0B, 0x00, 0x22, 0x5A, 0x52, 0x10, 0x32, 0x0A, 0x10, 0x0A,
+    0x0B, 0x00, 0x21, 0x0A, 0xA2, 0x3A, 0x10, 0x34, 0x0A, 0x10, 0x07, 0x0B, 0x00, 0x22, 0x0A, 0xA2,
+    0x3A, 0x10, 0x34, 0x0A, 0x10, 0x05, 0x0C, 0x00, 0x23, 0x1A, 0x72, 0x10, 0x36, 0x0A, 0x10, 0x03,
+    0x0D, 0x00, 0x24, 0x1A, 0x72, 0x10, 0x36, 0x0A, 0x10, 0x00, 0x0E, 0x00, 0x24, 0x5A, 0x2A, 0x52,
+    0x10, 0x36, 0x08, 0x06, 0x00, 0x26, 0x5A, 0x2A, 0x52, 0x10, 0x36, 0x08, 0x02, 0x00, 0x2A, 0x5A,
+    0x72, 0x2A, 0x10, 0x38, 0x0A, 0x00, 0x30, 0x5A, 0x72, 0x2A, 0x10, 0x38, 0x0A, 0x00, 0x30, 0x5A,
+    0x32, 0x42, 0x10, 0x38, 0x0A, 0x00, 0x30, 0x5A, 0x32, 0x42, 0x10, 0x38, 0x0A, 0x00, 0x30, 0x5A,
+    0x62, 0x42, 0x10, 0x37, 0x0B, 0x00, 0x30, 0x5A, 0x62, 0x42, 0x10, 0x37, 0x0B, 0x00, 0x30, 0x5A,
+    0xB2, 0x42, 0x10, 0x37, 0x0B, 0x00, 0x30, 0x5A, 0xB2, 0x42, 0x10, 0x37, 0x0B, 0x00, 0x30, 0x6A,
+    0x42, 0x2A, 0x10, 0x37, 0x0B, 0x00, 0x30, 0x6A, 0x42, 0x2A, 0x10, 0x37, 0x0B, 0x00, 0x30, 0x9A,
+    0x42, 0x32, 0x3A, 0x10, 0x35, 0x0B, 0x00, 0x30, 0x9A, 0x42, 0x32, 0x3A, 0x10, 0x35, 0x0B, 0x00,
+    0x30, 0x6A, 0x42, 0x62, 0x32, 0x10, 0x36, 0x0A, 0x00, 0x30, 0x6A, 0x42, 0x62, 0x32, 0x10, 0x36,
+    0x0A, 0x00, 0x30, 0x8A, 0x3E, 0x10, 0x36, 0x0A, 0x00, 0x30, 0x8A, 0x3E, 0x10, 0x36, 0x0A, 0x00,
+    0x30, 0x5A, 0x32, 0x3A, 0x62, 0x10, 0x36, 0x0A, 0x00, 0x30, 0x5A, 0x32, 0x3A, 0x62, 0x10, 0x36,
+    0x0A, 0x00, 0x32, 0x6A, 0x2A, 0x3A, 0x82, 0x10, 0x32, 0x0A, 0x00, 0x34, 0x6A, 0x2A, 0x3A, 0x82,
+    0x10, 0x32, 0x0A, 0x00, 0x34, 0x6A, 0x72, 0x82, 0x62, 0x10, 0x32, 0x0A, 0x00, 0x34, 0x6A, 0x72,
+    0x82, 0x62, 0x10, 0x32, 0x0A, 0x00, 0x36, 0x7A, 0x74, 0x10, 0x30, 0x0A, 0x00, 0x38, 0x7A, 0x73,
+    0x29, 0x62, 0x81, 0x10, 0x2D, 0x0A, 0x00, 0x38, 0x1A, 0x2A, 0x41, 0x31, 0x41, 0x71, 0x39, 0x81,
+    0x10, 0x2C, 0x0A, 0x00, 0x38, 0x1A, 0x2A, 0x41, 0x31, 0x41, 0x31, 0x61, 0x39, 0x10, 0x2C, 0x0A,
+    0x00, 0x3A, 0x8A, 0x72, 0x61, 0x71, 0x62, 0x81, 0x10, 0x29, 0x0A, 0x00, 0x3C, 0x8A, 0x72, 0x61,
+    0x41, 0x39, 0x61, 0x39, 0x81, 0x10, 0x28, 0x0A, 0x00, 0x3C, 0x1A, 0x82, 0x72, 0x61, 0x71, 0x61,
+    0x39, 0x10, 0x28, 0x0A, 0x00, 0x3C, 0x1A, 0x82, 0x72, 0x39, 0x41, 0x62, 0x81, 0x10, 0x27, 0x0A,
+    0x00, 0x3E, 0x5A, 0x62, 0x51, 0xA1, 0x61, 0x41, 0x61, 0x39, 0x81, 0x10, 0x23, 0x0A, 0x00, 0x40,
+    0x5A, 0x62, 0x52, 0x39, 0x61, 0x71, 0x41, 0x61, 0x10, 0x23, 0x0A, 0x00, 0x42, 0x6A, 0x62, 0x71,
+    0x31, 0x49, 0x51, 0x71, 0x61, 0x39, 0x81, 0x10, 0x1E, 0x0A, 0x00, 0x44, 0x6A, 0x62, 0x72, 0x31,
+    0x29, 0x41, 0x61, 0x73, 0x39, 0x81, 0x10, 0x1B, 0x0A, 0x00, 0x46, 0x5A, 0x63, 0x41, 0x71, 0x33,
+    0x4A, 0x71, 0x61, 0x10, 0x14, 0x62, 0x72, 0x8A, 0x00, 0x48, 0x5A, 0x66, 0x41, 0x71, 0x4A, 0x32,
+    0x42, 0x39, 0x81, 0x10, 0x0E, 0x82, 0x41, 0x61, 0x72, 0x8A, 0x00, 0x4A, 0x5A, 0x6A, 0x32, 0x3A,
+    0x41, 0x2A, 0x49, 0x72, 0x42, 0x72, 0x44, 0x74, 0x34, 0x72, 0x2A, 0xA1, 0x51, 0xA1, 0xB9, 0x49,
+    0x29, 0x79, 0x59, 0x1A, 0x00, 0x4C, 0x5A, 0x6A, 0x32, 0x3A, 0x63, 0x73, 0x42, 0x72, 0x44, 0x74,
+    0x34, 0x72, 0x2A, 0xA1, 0x51, 0xA1, 0xB9, 0x49, 0x29, 0x79, 0x59, 0x1A, 0x00, 0x50, 0x7A, 0x22,
+    0x4A, 0x62, 0x42, 0x61, 0x43, 0x74, 0x2A, 0x42, 0x32, 0x72, 0x2A, 0x73, 0x41, 0x79, 0x69, 0x79,
+    0x59, 0x00, 0x54, 0x7A, 0x22, 0x4A, 0x62, 0x42, 0x3A, 0x82, 0x3C, 0x42, 0x82, 0x3A, 0x82, 0x62,
+    0x84, 0x0C, 0x00, 0x58, 0x0A, 0x7A, 0x22, 0x4C, 0x62, 0x82, 0x64, 0x3C, 0x62, 0x5A, 0x0A, 0x00,
+    0x5C, 0x0A, 0x7A, 0x22, 0x4C, 0x62, 0x82, 0x64, 0x3C, 0x62, 0x5A, 0x0A, 0x00, 0x60, 0x0C, 0x5C,
+    0x6A, 0x22, 0x7A, 0x6A, 0x8C, 0x00, 0x64, 0x0C, 0x5C, 0x6A, 0x22, 0x7A, 0x6A, 0x8C, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xE6,
+};
+
+const PackedIcon homeIcon = { 32, 32, ICON_ENCODING_RLE, 1, palette0, 2, homeIconData };
+const PackedIcon settingsIcon = { 32, 32, ICON_ENCODING_RLE, 1, palette0, 2, settingsIconData };
+const PackedIcon systemIcon = { 32, 32, ICON_ENCODING_RLE, 1, palette0, 2, systemIconData };
+const PackedIcon aboutIcon = { 32, 32, ICON_ENCODING_RLE, 1, palette0, 2, aboutIconData };
+const PackedIcon saveIcon = { 32, 32, ICON_ENCODING_RLE, 1, palette0, 2, saveIconData };
+const PackedIcon motorTuningIcon = { 32, 32, ICON_ENCODING_RLE, 1, palette0, 2, motorTuningIconData };
+const PackedIcon powerOffIcon = { 32, 32, ICON_ENCODING_PALETTE, 1, palette0, 2, powerOffIconData };
+const PackedIcon timerIcon = { 32, 32, ICON_ENCODING_RLE, 1, palette0, 2, timerIconData };
+const PackedIcon percentageIcon = { 32, 32, ICON_ENCODING_RLE, 1, palette0, 2, percentageIconData };
+const PackedIcon QRIcon = { 64, 64, ICON_ENCODING_RLE, 2, palette1, 4, QRIconData };
+const PackedIcon logoIcon = { 128, 128, ICON_ENCODING_RLE, 5, palette2, 24, logoIconData };
@@ -1,32 +1,54 @@
 #include <Arduino.h>
 #include "Config/config.h"
+#include "Config/BootProfile.h"
 #include "Tasks/TaskPower.h"
 #include "Tasks/TaskSaveData.h"
 #include "Tasks/TaskEncoder.h"
 #include "Tasks/TaskUI.h"
+#include "Tasks/TaskRender.h"
 #include "Tasks/TaskMotor.h"
 #include "Tasks/TaskBuzzer.h"
+#include "Tasks/TaskTelemetry.h"
 #include "esp_sleep.h"
 
 
 void setup()
 {
+    BootProfile_init();
     Config_init();
+    BootProfile_mark(BOOT_PHASE_CONFIG);
+
+    /* Display first: TaskRender brings up the TFT and draws the logo while the rest starts. */
+    TaskUI_init();
+    BootProfile_mark(BOOT_PHASE_UI);
+    TaskRender_init();
+
     TaskPower_init();
+    BootProfile_mark(BOOT_PHASE_POWER);
     TaskSaveData_init();
+    BootProfile_mark(BOOT_PHASE_SAVE_DATA);
     esp_sleep_wakeup_cause_t wakeup_reason = esp_sleep_get_wakeup_cause();
     TaskEncoder_init();
-    TaskUI_init();
+    BootProfile_mark(BOOT_PHASE_ENCODER);
     TaskMotor_init();
+    BootProfile_mark(BOOT_PHASE_MOTOR);
     TaskBuzzer_init();
+    BootProfile_mark(BOOT_PHASE_BUZZER);
+    TaskTelemetry_init();
+    BootProfile_mark(BOOT_PHASE_TELEMETRY);
     if(wakeup_reason == ESP_SLEEP_WAKEUP_EXT0) UI_setState(MENU_INIT);
 
     SettingsCommand cmd;
     cmd.type = SETTINGS_CMD_LOAD;
     xQueueSend(xSettingsQueue, &cmd, 0);
 
+    BootProfile_mark(BOOT_PHASE_SETUP_DONE);
 }
 
 void loop()
 {
-}
\ No newline at end of file
+    /* Everything runs in tasks; report the boot and free the loop task's core time. */
+    if (BootProfile_waitInteractive(portMAX_DELAY))
+        BootProfile_report();
+    vTaskDelete(nullptr);
+}
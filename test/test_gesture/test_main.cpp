@@ -0,0 +1,342 @@
+/**
+ * @file test_main.cpp
+ * @brief Host tests for the gesture recogniser in Gesture.h.
+ *
+ * Each test drives a recogniser with timestamped button edges, detents
+ * and ticks the way TaskEncoder does, using GESTURE_CONFIG_DEFAULT. Ticks
+ * are fed every millisecond so each event is seen at the first instant
+ * it is due.
+ *
+ * Run with `pio test -e native`.
+ */
+#include "Input/Gesture.h"
+#include <unity.h>
+
+/** @brief Most events a single test collects. */
+static constexpr int MAX_LOG = 32;
+
+/** @brief Recogniser with every event it has produced, in order. */
+struct Harness
+{
+    Gesture    g;
+    InputEvent log[MAX_LOG];
+    int        count;
+    uint32_t   nowMs;      ///< Time of the last input or tick.
+};
+
+static Harness harness;
+
+static void record(const InputEvent* out, uint8_t n)
+{
+    TEST_ASSERT_TRUE(n <= GESTURE_MAX_EVENTS);
+    for (uint8_t i = 0; i < n; i++)
+    {
+        TEST_ASSERT_TRUE(harness.count < MAX_LOG);
+        harness.log[harness.count++] = out[i];
+    }
+}
+
+/** @brief Ticks every millisecond from the last input up to and including `untilMs`. */
+static void tickUntil(uint32_t untilMs)
+{
+    InputEvent out[GESTURE_MAX_EVENTS];
+
+    while ((int32_t)(untilMs - harness.nowMs) > 0)
+    {
+        harness.nowMs++;
+        record(out, Gesture_tick(&harness.g, harness.nowMs, out));
+    }
+}
+
+/** @brief Ticks up to `atMs`, then feeds a button edge at that time. */
+static void button(bool pressed, uint32_t atMs)
+{
+    InputEvent out[GESTURE_MAX_EVENTS];
+
+    tickUntil(atMs);
+    record(out, Gesture_button(&harness.g, pressed, atMs, out));
+}
+
+/** @brief Ticks up to `atMs`, then feeds `delta` detents at that time. */
+static void rotate(int16_t delta, uint32_t atMs)
+{
+    InputEvent out[GESTURE_MAX_EVENTS];
+
+    tickUntil(atMs);
+    record(out, Gesture_rotate(&harness.g, delta, atMs, out));
+}
+
+static int countOf(InputEventType type)
+{
+    int n = 0;
+    for (int i = 0; i < harness.count; i++)
+        if (harness.log[i].type == type)
+            n++;
+    return n;
+}
+
+static void assertEvent(int index, InputEventType type, uint32_t timestampMs)
+{
+    TEST_ASSERT_TRUE_MESSAGE(index < harness.count, "event missing");
+    TEST_ASSERT_EQUAL_INT(type, harness.log[index].type);
+    TEST_ASSERT_EQUAL_UINT32(timestampMs, harness.log[index].timestampMs);
+}
+
+/* =========================
+   CLICKS
+   ========================= */
+
+void test_single_click_waits_for_double_click_window()
+{
+    button(true, 100);
+    button(false, 180);
+    TEST_ASSERT_EQUAL_INT(0, harness.count);
+
+    tickUntil(180 + GESTURE_CONFIG_DEFAULT.doubleClickMs - 1);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, harness.count, "click reported inside the double-click window");
+
+    tickUntil(180 + GESTURE_CONFIG_DEFAULT.doubleClickMs);
+    TEST_ASSERT_EQUAL_INT(1, harness.count);
+    assertEvent(0, BTN_SHORT, 180);
+    TEST_ASSERT_EQUAL_UINT32(80, harness.log[0].pressMs);
+
+    tickUntil(2000);
+    TEST_ASSERT_EQUAL_INT(1, harness.count);
+}
+
+void test_double_click_reports_double_only()
+{
+    button(true, 100);
+    button(false, 180);
+    button(true, 180 + GESTURE_CONFIG_DEFAULT.doubleClickMs - 10);
+    button(false, 500);
+    tickUntil(2000);
+
+    TEST_ASSERT_EQUAL_INT(1, harness.count);
+    assertEvent(0, BTN_DOUBLE, 500);
+    TEST_ASSERT_EQUAL_INT(0, countOf(BTN_SHORT));
+}
+
+void test_second_press_after_window_is_two_clicks()
+{
+    button(true, 100);
+    button(false, 180);
+    button(true, 180 + GESTURE_CONFIG_DEFAULT.doubleClickMs + 20);
+    button(false, 500);
+    tickUntil(2000);
+
+    TEST_ASSERT_EQUAL_INT(2, harness.count);
+    assertEvent(0, BTN_SHORT, 180);
+    assertEvent(1, BTN_SHORT, 500);
+    TEST_ASSERT_EQUAL_INT(0, countOf(BTN_DOUBLE));
+}
+
+void test_rotate_flushes_pending_click_first()
+{
+    button(true, 100);
+    button(false, 180);
+    rotate(2, 200);
+
+    TEST_ASSERT_EQUAL_INT(2, harness.count);
+    assertEvent(0, BTN_SHORT, 180);
+    assertEvent(1, ENC_ROTATE, 200);
+    TEST_ASSERT_EQUAL_INT(2, harness.log[1].delta);
+
+    tickUntil(2000);
+    TEST_ASSERT_EQUAL_INT(2, harness.count);
+}
+
+/* =========================
+   LONG PRESS AND REPEAT
+   ========================= */
+
+void test_hold_reports_long_then_repeats()
+{
+    const uint32_t press    = 100;
+    const uint32_t longAt   = press + GESTURE_CONFIG_DEFAULT.longPressMs;
+    const uint32_t repeatAt = longAt + GESTURE_CONFIG_DEFAULT.repeatDelayMs;
+
+    button(true, press);
+    tickUntil(longAt - 1);
+    TEST_ASSERT_EQUAL_INT(0, harness.count);
+
+    tickUntil(longAt);
+    TEST_ASSERT_EQUAL_INT(1, harness.count);
+    assertEvent(0, BTN_LONG, longAt);
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_CONFIG_DEFAULT.longPressMs, harness.log[0].pressMs);
+
+    tickUntil(repeatAt - 1);
+    TEST_ASSERT_EQUAL_INT(1, harness.count);
+
+    const int REPEATS = 4;
+    tickUntil(repeatAt + (REPEATS - 1) * GESTURE_CONFIG_DEFAULT.repeatPeriodMs);
+    TEST_ASSERT_EQUAL_INT(1 + REPEATS, harness.count);
+    for (int i = 0; i < REPEATS; i++)
+    {
+        uint32_t at = repeatAt + i * GESTURE_CONFIG_DEFAULT.repeatPeriodMs;
+        assertEvent(1 + i, BTN_REPEAT, at);
+        TEST_ASSERT_EQUAL_UINT32(at - press, harness.log[1 + i].pressMs);
+    }
+
+    button(false, repeatAt + REPEATS * GESTURE_CONFIG_DEFAULT.repeatPeriodMs - 1);
+    tickUntil(10000);
+    TEST_ASSERT_EQUAL_INT(1 + REPEATS, harness.count);
+    TEST_ASSERT_EQUAL_INT(0, countOf(BTN_SHORT));
+}
+
+void test_release_before_long_press_is_click()
+{
+    button(true, 100);
+    button(false, 100 + GESTURE_CONFIG_DEFAULT.longPressMs - 1);
+    tickUntil(5000);
+
+    TEST_ASSERT_EQUAL_INT(1, harness.count);
+    TEST_ASSERT_EQUAL_INT(BTN_SHORT, harness.log[0].type);
+}
+
+/* =========================
+   PRESS AND ROTATE
+   ========================= */
+
+void test_press_rotate_suppresses_click_and_long()
+{
+    button(true, 100);
+    rotate(1, 200);
+    rotate(-3, 300);
+    tickUntil(100 + 3 * GESTURE_CONFIG_DEFAULT.longPressMs);
+    button(false, 100 + 3 * GESTURE_CONFIG_DEFAULT.longPressMs);
+    tickUntil(5000);
+
+    TEST_ASSERT_EQUAL_INT(2, harness.count);
+    assertEvent(0, ENC_PRESS_ROTATE, 200);
+    TEST_ASSERT_EQUAL_INT(1, harness.log[0].delta);
+    assertEvent(1, ENC_PRESS_ROTATE, 300);
+    TEST_ASSERT_EQUAL_INT(-3, harness.log[1].delta);
+    TEST_ASSERT_EQUAL_INT(0, countOf(BTN_SHORT));
+    TEST_ASSERT_EQUAL_INT(0, countOf(BTN_LONG));
+    TEST_ASSERT_EQUAL_INT(0, countOf(BTN_REPEAT));
+}
+
+void test_press_rotate_before_quick_release()
+{
+    button(true, 100);
+    rotate(1, 150);
+    button(false, 200);
+    tickUntil(5000);
+
+    TEST_ASSERT_EQUAL_INT(1, harness.count);
+    assertEvent(0, ENC_PRESS_ROTATE, 150);
+}
+
+/* =========================
+   DEADLINES
+   ========================= */
+
+void test_deadline_idle()
+{
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, Gesture_msUntilDeadline(&harness.g, 0));
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, Gesture_msUntilDeadline(&harness.g, 123456));
+}
+
+void test_deadline_pressed_is_long_press()
+{
+    button(true, 100);
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_CONFIG_DEFAULT.longPressMs, Gesture_msUntilDeadline(&harness.g, 100));
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_CONFIG_DEFAULT.longPressMs - 250, Gesture_msUntilDeadline(&harness.g, 350));
+    TEST_ASSERT_EQUAL_UINT32(0, Gesture_msUntilDeadline(&harness.g, 100 + GESTURE_CONFIG_DEFAULT.longPressMs));
+}
+
+void test_deadline_click_pending_is_double_click_window()
+{
+    button(true, 100);
+    button(false, 180);
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_CONFIG_DEFAULT.doubleClickMs, Gesture_msUntilDeadline(&harness.g, 180));
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_CONFIG_DEFAULT.doubleClickMs - 100, Gesture_msUntilDeadline(&harness.g, 280));
+
+    tickUntil(180 + GESTURE_CONFIG_DEFAULT.doubleClickMs);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, Gesture_msUntilDeadline(&harness.g, harness.nowMs));
+}
+
+void test_deadline_held_is_next_repeat()
+{
+    const uint32_t longAt = 100 + GESTURE_CONFIG_DEFAULT.longPressMs;
+
+    button(true, 100);
+    tickUntil(longAt);
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_CONFIG_DEFAULT.repeatDelayMs, Gesture_msUntilDeadline(&harness.g, longAt));
+
+    tickUntil(longAt + GESTURE_CONFIG_DEFAULT.repeatDelayMs);
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_CONFIG_DEFAULT.repeatPeriodMs, Gesture_msUntilDeadline(&harness.g, harness.nowMs));
+
+    button(false, harness.nowMs + 10);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, Gesture_msUntilDeadline(&harness.g, harness.nowMs));
+}
+
+/** @brief Sleeping exactly as long as the deadline says lands on each event. */
+void test_deadline_drives_ticks()
+{
+    InputEvent out[GESTURE_MAX_EVENTS];
+    uint32_t   now = 100;
+
+    button(true, now);
+    for (int i = 0; i < 4; i++)
+    {
+        uint32_t wait = Gesture_msUntilDeadline(&harness.g, now);
+        TEST_ASSERT_TRUE(wait != UINT32_MAX && wait > 0);
+        TEST_ASSERT_EQUAL_INT(0, Gesture_tick(&harness.g, now + wait - 1, out));
+        now += wait;
+        TEST_ASSERT_EQUAL_INT(1, Gesture_tick(&harness.g, now, out));
+        TEST_ASSERT_EQUAL_INT(i == 0 ? BTN_LONG : BTN_REPEAT, out[0].type);
+    }
+}
+
+/** @brief Timing is measured with wrapping subtraction, so the 49-day rollover is invisible. */
+void test_clock_wrap()
+{
+    const uint32_t press = UINT32_MAX - 50;
+
+    Gesture_init(&harness.g, GESTURE_CONFIG_DEFAULT);
+    harness.nowMs = press - 1;
+
+    button(true, press);
+    button(false, press + 100);
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_CONFIG_DEFAULT.doubleClickMs, Gesture_msUntilDeadline(&harness.g, press + 100));
+
+    tickUntil(press + 100 + GESTURE_CONFIG_DEFAULT.doubleClickMs);
+    TEST_ASSERT_EQUAL_INT(1, harness.count);
+    assertEvent(0, BTN_SHORT, press + 100);
+    TEST_ASSERT_EQUAL_UINT32(100, harness.log[0].pressMs);
+}
+
+void setUp()
+{
+    harness = {};
+    Gesture_init(&harness.g, GESTURE_CONFIG_DEFAULT);
+}
+
+void tearDown() {}
+
+int main()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_single_click_waits_for_double_click_window);
+    RUN_TEST(test_double_click_reports_double_only);
+    RUN_TEST(test_second_press_after_window_is_two_clicks);
+    RUN_TEST(test_rotate_flushes_pending_click_first);
+
+    RUN_TEST(test_hold_reports_long_then_repeats);
+    RUN_TEST(test_release_before_long_press_is_click);
+
+    RUN_TEST(test_press_rotate_suppresses_click_and_long);
+    RUN_TEST(test_press_rotate_before_quick_release);
+
+    RUN_TEST(test_deadline_idle);
+    RUN_TEST(test_deadline_pressed_is_long_press);
+    RUN_TEST(test_deadline_click_pending_is_double_click_window);
+    RUN_TEST(test_deadline_held_is_next_repeat);
+    RUN_TEST(test_deadline_drives_ticks);
+    RUN_TEST(test_clock_wrap);
+
+    return UNITY_END();
+}
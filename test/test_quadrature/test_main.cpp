@@ -0,0 +1,383 @@
+/**
+ * @file test_main.cpp
+ * @brief Host test vectors and throughput benchmark for QuadratureDecoder.h.
+ *
+ * Every sequence is run in full-, half- and quarter-step mode, and again
+ * with the step mode and rest states the firmware ships (EncoderConfig.h).
+ * Pin states
+ * are generated by walking the clockwise cycle 00 → 10 → 11 → 01, so a
+ * test only says how far to move and the encoder mode decides how many
+ * states make a detent.
+ *
+ * Run with `pio test -e native`.
+ */
+#include "Input/QuadratureDecoder.h"
+#include "Input/EncoderConfig.h"
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+
+/** @brief Pin states in clockwise order. */
+static constexpr uint8_t CW_ORDER[4] = { 0b00, 0b10, 0b11, 0b01 };
+
+/** @brief Detents walked by each clean-rotation test. */
+static constexpr int DETENTS = 8;
+
+/** @brief Encoder mode under test. */
+struct ModeCase
+{
+    const char*  name;
+    QuadStepMode mode;
+    uint8_t      restMask;
+    uint8_t      restPos;  ///< Index in CW_ORDER of a rest state.
+};
+
+static const ModeCase FULL    = { "full",    QUAD_FULL_STEP,    QUAD_REST_FULL,    2 };
+static const ModeCase HALF    = { "half",    QUAD_HALF_STEP,    QUAD_REST_HALF,    0 };
+static const ModeCase QUARTER = { "quarter", QUAD_QUARTER_STEP, QUAD_REST_QUARTER, 0 };
+
+/** @brief Index in CW_ORDER of the first state in `restMask`. */
+static constexpr uint8_t firstRestPos(uint8_t restMask)
+{
+    return (restMask & QUAD_STATE_BIT(CW_ORDER[0])) ? 0
+         : (restMask & QUAD_STATE_BIT(CW_ORDER[1])) ? 1
+         : (restMask & QUAD_STATE_BIT(CW_ORDER[2])) ? 2
+         : 3;
+}
+
+/** @brief The encoder as TaskEncoder configures it. */
+static const ModeCase SHIPPED = { "shipped", ENCODER_STEP_MODE, ENCODER_REST_STATES,
+                                  firstRestPos(ENCODER_REST_STATES) };
+
+/** @brief Decoder fed one position of CW_ORDER at a time, with its outputs tallied. */
+struct Encoder
+{
+    QuadDecoder dec;
+    uint8_t     pos;      ///< Current index in CW_ORDER.
+    int         net;      ///< Sum of reported detents.
+    int         cw;       ///< Clockwise detents reported.
+    int         ccw;      ///< Counter-clockwise detents reported.
+};
+
+static Encoder makeEncoder(const ModeCase& mc)
+{
+    Encoder enc = {};
+    enc.pos = mc.restPos;
+    QuadDecoder_init(&enc.dec, mc.mode, mc.restMask, CW_ORDER[enc.pos]);
+    return enc;
+}
+
+/** @brief Feeds the state at `pos` (taken modulo 4) and tallies the output. */
+static void feedPos(Encoder& enc, int pos)
+{
+    enc.pos = (uint8_t)(pos & 3);
+
+    int8_t out = QuadDecoder_update(&enc.dec, CW_ORDER[enc.pos]);
+    enc.net += out;
+    if (out > 0) enc.cw++;
+    if (out < 0) enc.ccw++;
+}
+
+/** @brief Moves one quadrature step; `dir` is +1 clockwise, −1 counter-clockwise. */
+static void step(Encoder& enc, int dir)
+{
+    feedPos(enc, enc.pos + dir);
+}
+
+static void walk(Encoder& enc, int steps, int dir)
+{
+    for (int i = 0; i < steps; i++)
+        step(enc, dir);
+}
+
+/* =========================
+   CLEAN ROTATION
+   ========================= */
+
+static void checkClean(const ModeCase& mc, int dir)
+{
+    Encoder enc = makeEncoder(mc);
+
+    walk(enc, DETENTS * mc.mode, dir);
+
+    TEST_ASSERT_EQUAL_INT_MESSAGE(dir * DETENTS, enc.net, mc.name);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(DETENTS, dir > 0 ? enc.cw : enc.ccw, mc.name);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, dir > 0 ? enc.ccw : enc.cw, mc.name);
+}
+
+void test_full_clean_cw()     { checkClean(FULL,     +1); }
+void test_full_clean_ccw()    { checkClean(FULL,     -1); }
+void test_half_clean_cw()     { checkClean(HALF,     +1); }
+void test_half_clean_ccw()    { checkClean(HALF,     -1); }
+void test_quarter_clean_cw()  { checkClean(QUARTER,  +1); }
+void test_quarter_clean_ccw() { checkClean(QUARTER,  -1); }
+void test_shipped_clean_cw()  { checkClean(SHIPPED,  +1); }
+void test_shipped_clean_ccw() { checkClean(SHIPPED,  -1); }
+
+/* =========================
+   CONTACT BOUNCE
+   ========================= */
+
+/** @brief Times a contact chatters back and forth across each edge. */
+static constexpr int BOUNCES = 3;
+
+/**
+ * @brief Bounces every edge of DETENTS detents before it settles.
+ *
+ * Full- and half-step decoders must report exactly the clean detents.
+ * A quarter-step decoder sees each bounce as a real state and so reports
+ * it, but the chatter must cancel out.
+ */
+static void checkBounce(const ModeCase& mc, int dir)
+{
+    Encoder enc = makeEncoder(mc);
+
+    for (int i = 0; i < DETENTS * mc.mode; i++)
+    {
+        for (int b = 0; b < BOUNCES; b++)
+        {
+            step(enc, dir);
+            step(enc, -dir);
+        }
+        step(enc, dir);
+    }
+
+    TEST_ASSERT_EQUAL_INT_MESSAGE(dir * DETENTS, enc.net, mc.name);
+
+    if (mc.mode != QUAD_QUARTER_STEP)
+    {
+        TEST_ASSERT_EQUAL_INT_MESSAGE(DETENTS, dir > 0 ? enc.cw : enc.ccw, mc.name);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, dir > 0 ? enc.ccw : enc.cw, mc.name);
+    }
+}
+
+/**
+ * @brief Chatter across any one edge counts the same as crossing it once.
+ */
+static void checkChatterOnly(const ModeCase& mc)
+{
+    for (int edge = 0; edge < (int)mc.mode; edge++)
+    {
+        Encoder clean = makeEncoder(mc);
+        walk(clean, edge + 1, +1);
+
+        Encoder noisy = makeEncoder(mc);
+        walk(noisy, edge, +1);
+        for (int b = 0; b < BOUNCES; b++)
+        {
+            step(noisy, +1);
+            step(noisy, -1);
+        }
+        step(noisy, +1);
+
+        TEST_ASSERT_EQUAL_INT_MESSAGE(clean.net, noisy.net, mc.name);
+        if (mc.mode != QUAD_QUARTER_STEP)
+            TEST_ASSERT_EQUAL_INT_MESSAGE(clean.cw, noisy.cw, mc.name);
+    }
+}
+
+void test_full_bounce_cw()     { checkBounce(FULL,    +1); }
+void test_full_bounce_ccw()    { checkBounce(FULL,    -1); }
+void test_half_bounce_cw()     { checkBounce(HALF,    +1); }
+void test_half_bounce_ccw()    { checkBounce(HALF,    -1); }
+void test_quarter_bounce_cw()  { checkBounce(QUARTER, +1); }
+void test_quarter_bounce_ccw() { checkBounce(QUARTER, -1); }
+void test_shipped_bounce_cw()  { checkBounce(SHIPPED, +1); }
+void test_shipped_bounce_ccw() { checkBounce(SHIPPED, -1); }
+
+void test_full_chatter_only()    { checkChatterOnly(FULL); }
+void test_half_chatter_only()    { checkChatterOnly(HALF); }
+void test_quarter_chatter_only() { checkChatterOnly(QUARTER); }
+void test_shipped_chatter_only() { checkChatterOnly(SHIPPED); }
+
+/* =========================
+   SKIPPED STATES
+   ========================= */
+
+/**
+ * @brief Both pins changing at once (e.g. 00 → 11) is rejected, and the
+ *        decoder is back in step at the next rest state.
+ */
+static void checkSkip(const ModeCase& mc)
+{
+    Encoder enc = makeEncoder(mc);
+
+    /* Jump to the opposite state and back: two illegal transitions, no movement. */
+    feedPos(enc, enc.pos + 2);
+    feedPos(enc, enc.pos + 2);
+
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, enc.cw + enc.ccw, mc.name);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, enc.dec.acc, mc.name);
+
+    /* Back at rest with a clear accumulator: the next detents count exactly. */
+    walk(enc, DETENTS * mc.mode, +1);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(DETENTS, enc.net, mc.name);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, enc.ccw, mc.name);
+}
+
+/**
+ * @brief Partial movement followed by an illegal jump is dropped when a
+ *        rest state is reached, instead of being carried into the next detent.
+ */
+static void checkResync(const ModeCase& mc)
+{
+    if (mc.mode == QUAD_QUARTER_STEP)
+        return; // every state is a rest state: there is no partial movement
+
+    Encoder enc = makeEncoder(mc);
+
+    /* One step clockwise, an illegal jump, then back to the rest state counter-clockwise. */
+    step(enc, +1);
+    feedPos(enc, enc.pos + 2);
+    while ((mc.restMask & QUAD_STATE_BIT(CW_ORDER[enc.pos])) == 0)
+        step(enc, -1);
+
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, enc.dec.acc, mc.name);
+    const int before = enc.net;
+
+    walk(enc, DETENTS * mc.mode, -1);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(before - DETENTS, enc.net, mc.name);
+}
+
+void test_full_skipped_state()    { checkSkip(FULL); }
+void test_half_skipped_state()    { checkSkip(HALF); }
+void test_quarter_skipped_state() { checkSkip(QUARTER); }
+void test_shipped_skipped_state() { checkSkip(SHIPPED); }
+
+void test_full_resync()    { checkResync(FULL); }
+void test_half_resync()    { checkResync(HALF); }
+void test_shipped_resync() { checkResync(SHIPPED); }
+
+/** @brief One missed intermediate state does not lose a full-step detent. */
+void test_full_one_missed_state_keeps_detent()
+{
+    Encoder enc = makeEncoder(FULL);
+
+    step(enc, +1);
+    step(enc, +1);
+    feedPos(enc, enc.pos + 2); // skips the last intermediate state straight into rest
+
+    TEST_ASSERT_EQUAL_INT(1, enc.net);
+    TEST_ASSERT_EQUAL_INT(0, enc.dec.acc);
+}
+
+/* =========================
+   REVERSAL MID-DETENT
+   ========================= */
+
+/**
+ * @brief Turning back before the next rest state reports nothing, however
+ *        far the detent had got; a full detent the other way then counts.
+ */
+static void checkReversal(const ModeCase& mc)
+{
+    Encoder enc = makeEncoder(mc);
+
+    for (int depth = 1; depth < (int)mc.mode; depth++)
+    {
+        walk(enc, depth, +1);
+        walk(enc, depth, -1);
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, enc.cw + enc.ccw, mc.name);
+
+    /* Quarter step: every state is a detent, so a reversal is a detent each way. */
+    step(enc, +1);
+    step(enc, -1);
+    if (mc.mode == QUAD_QUARTER_STEP)
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, enc.net, mc.name);
+    else
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, enc.cw + enc.ccw, mc.name);
+
+    walk(enc, mc.mode, -1);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(-1, enc.net, mc.name);
+}
+
+void test_full_reversal()    { checkReversal(FULL); }
+void test_half_reversal()    { checkReversal(HALF); }
+void test_quarter_reversal() { checkReversal(QUARTER); }
+void test_shipped_reversal() { checkReversal(SHIPPED); }
+
+/* =========================
+   THROUGHPUT
+   ========================= */
+
+/** @brief Transitions fed per mode by the benchmark. */
+static constexpr uint32_t BENCH_TRANSITIONS = 20000000;
+
+static void benchmark(const ModeCase& mc)
+{
+    QuadDecoder dec;
+    QuadDecoder_init(&dec, mc.mode, mc.restMask, CW_ORDER[mc.restPos]);
+
+    int32_t net = 0;
+    auto    t0  = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 1; i <= BENCH_TRANSITIONS; i++)
+        net += QuadDecoder_update(&dec, CW_ORDER[(mc.restPos + i) & 3]);
+
+    auto   t1   = std::chrono::steady_clock::now();
+    double secs = std::chrono::duration<double>(t1 - t0).count();
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%-7s step: %.1f M transitions/s", mc.name, BENCH_TRANSITIONS / secs / 1e6);
+    TEST_MESSAGE(msg);
+
+    /* Also keeps the loop from being optimised away. */
+    TEST_ASSERT_EQUAL_INT_MESSAGE((int32_t)(BENCH_TRANSITIONS / mc.mode), net, mc.name);
+}
+
+void test_throughput()
+{
+    benchmark(FULL);
+    benchmark(HALF);
+    benchmark(QUARTER);
+    benchmark(SHIPPED);
+}
+
+void setUp() {}
+void tearDown() {}
+
+int main()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_full_clean_cw);
+    RUN_TEST(test_full_clean_ccw);
+    RUN_TEST(test_half_clean_cw);
+    RUN_TEST(test_half_clean_ccw);
+    RUN_TEST(test_quarter_clean_cw);
+    RUN_TEST(test_quarter_clean_ccw);
+    RUN_TEST(test_shipped_clean_cw);
+    RUN_TEST(test_shipped_clean_ccw);
+
+    RUN_TEST(test_full_bounce_cw);
+    RUN_TEST(test_full_bounce_ccw);
+    RUN_TEST(test_half_bounce_cw);
+    RUN_TEST(test_half_bounce_ccw);
+    RUN_TEST(test_quarter_bounce_cw);
+    RUN_TEST(test_quarter_bounce_ccw);
+    RUN_TEST(test_shipped_bounce_cw);
+    RUN_TEST(test_shipped_bounce_ccw);
+    RUN_TEST(test_full_chatter_only);
+    RUN_TEST(test_half_chatter_only);
+    RUN_TEST(test_quarter_chatter_only);
+    RUN_TEST(test_shipped_chatter_only);
+
+    RUN_TEST(test_full_skipped_state);
+    RUN_TEST(test_half_skipped_state);
+    RUN_TEST(test_quarter_skipped_state);
+    RUN_TEST(test_shipped_skipped_state);
+    RUN_TEST(test_full_resync);
+    RUN_TEST(test_half_resync);
+    RUN_TEST(test_shipped_resync);
+    RUN_TEST(test_full_one_missed_state_keeps_detent);
+
+    RUN_TEST(test_full_reversal);
+    RUN_TEST(test_half_reversal);
+    RUN_TEST(test_quarter_reversal);
+    RUN_TEST(test_shipped_reversal);
+
+    RUN_TEST(test_throughput);
+
+    return UNITY_END();
+}